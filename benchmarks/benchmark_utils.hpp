@@ -0,0 +1,323 @@
+#ifndef STRF_BENCHMARKS_BENCHMARK_UTILS_HPP_INCLUDED
+#define STRF_BENCHMARKS_BENCHMARK_UTILS_HPP_INCLUDED
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <strf/to_string.hpp>
+#include <strf/to_chunks.hpp>
+#include <strf/to_pooled_string.hpp>
+#include <strf/to_ring_buffer.hpp>
+#include <strf/to_cfile.hpp>
+#include <strf/to_async_cfile.hpp>
+#include <strf/to_streambuf.hpp>
+#if ! defined(_WIN32)
+#  include <strf/to_fd.hpp>
+#  include <strf/to_mmap_file.hpp>
+#  include <strf/to_uring_fd.hpp>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstdlib>
+#include <streambuf>
+#include <string>
+
+namespace bench_utils {
+
+// Reports the number of characters written in the last iteration
+// as "bytes/op", and the corresponding throughput as bytes_per_second.
+template <typename CharT>
+inline void report(benchmark::State& state, std::size_t count)
+{
+    const auto bytes = count * sizeof(CharT);
+    state.counters["bytes/op"] = static_cast<double>(bytes);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+
+template <typename CharT>
+class null_streambuf: public std::basic_streambuf<CharT>
+{
+    using int_type_ = typename std::basic_streambuf<CharT>::int_type;
+    using traits_type_ = typename std::basic_streambuf<CharT>::traits_type;
+
+protected:
+
+    int_type_ overflow(int_type_ ch) override
+    {
+        return traits_type_::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const CharT*, std::streamsize count) override
+    {
+        return count;
+    }
+};
+
+inline std::FILE* null_cfile()
+{
+#if defined(_WIN32)
+    static std::FILE* file = std::fopen("NUL", "w");
+#else
+    static std::FILE* file = std::fopen("/dev/null", "w");
+#endif
+    if (file == nullptr) {
+        std::perror("Could not open the null device");
+        std::abort();
+    }
+    return file;
+}
+
+#if ! defined(_WIN32)
+
+inline int null_fd()
+{
+    static int fd = ::open("/dev/null", O_WRONLY);
+    if (fd < 0) {
+        std::perror("Could not open the null device");
+        std::abort();
+    }
+    return fd;
+}
+
+// A temporary file that is overwritten in each iteration
+inline int tmp_rdwr_fd()
+{
+    static int fd = [] {
+        char path[] = "/tmp/strf_benchmark_XXXXXX";
+        int f = ::mkstemp(path);
+        if (f >= 0) {
+            ::unlink(path);
+        }
+        return f;
+    } ();
+    if (fd < 0) {
+        std::perror("Could not create a temporary file");
+        std::abort();
+    }
+    return fd;
+}
+
+#endif // ! defined(_WIN32)
+
+} // namespace bench_utils
+
+#define STRF_BENCH_CAT2_(A, B) A ## B
+#define STRF_BENCH_CAT_(A, B) STRF_BENCH_CAT2_(A, B)
+#define STRF_BENCH_REGISTRAR_ STRF_BENCH_CAT_(strf_bench_registrar_, __COUNTER__)
+
+// Each of the macros below registers one benchmark. Its argument is
+// the text that follows the destination expression, for example:
+//
+//     STRF_BENCH_TO_CHAR_PTR( (strf::hex(x), ' ', y) )
+//     STRF_BENCH_TO_STRING( .with(punct) (strf::punct(x)) )
+//     STRF_BENCH_TO_CFILE( .tr("{} {}", x, y) )
+
+#define STRF_BENCH_TO_CSTR_(CHAR_T, NAME, ...)                               \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( NAME #__VA_ARGS__                                                   \
+        , [](benchmark::State& state) {                                       \
+              CHAR_T dest[4000];                                              \
+              CHAR_T* end = dest;                                             \
+              for (auto _ : state) {                                          \
+                  end = strf::to(dest) __VA_ARGS__ .ptr;                      \
+                  benchmark::DoNotOptimize(dest);                             \
+                  benchmark::ClobberMemory();                                 \
+              }                                                               \
+              bench_utils::report<CHAR_T>(state, end - dest);                 \
+          } );
+
+#define STRF_BENCH_TO_CHAR_PTR(...)                                          \
+    STRF_BENCH_TO_CSTR_(char, "strf::to(char*) ", __VA_ARGS__)
+
+#define STRF_BENCH_TO_CHAR16_PTR(...)                                        \
+    STRF_BENCH_TO_CSTR_(char16_t, "strf::to(char16_t*) ", __VA_ARGS__)
+
+#define STRF_BENCH_TO_CHAR32_PTR(...)                                        \
+    STRF_BENCH_TO_CSTR_(char32_t, "strf::to(char32_t*) ", __VA_ARGS__)
+
+#define STRF_BENCH_TO_STRING(...)                                            \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( "strf::to_string " #__VA_ARGS__                                     \
+        , [](benchmark::State& state) {                                       \
+              std::size_t size = 0;                                           \
+              for (auto _ : state) {                                          \
+                  auto str = strf::to_string __VA_ARGS__;                     \
+                  benchmark::DoNotOptimize(str.data());                       \
+                  size = str.size();                                          \
+              }                                                               \
+              bench_utils::report<char>(state, size);                         \
+          } );
+
+#define STRF_BENCH_TO_POOLED_STRING(...)                                     \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( "strf::to_pooled_string " #__VA_ARGS__                              \
+        , [](benchmark::State& state) {                                       \
+              std::size_t size = 0;                                           \
+              for (auto _ : state) {                                          \
+                  auto str = strf::to_pooled_string __VA_ARGS__;              \
+                  benchmark::DoNotOptimize(str.data());                       \
+                  size = str.size();                                          \
+              }                                                               \
+              bench_utils::report<char>(state, size);                         \
+          } );
+
+#define STRF_BENCH_TO_CHUNKS(...)                                            \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( "strf::to_chunks " #__VA_ARGS__                                     \
+        , [](benchmark::State& state) {                                       \
+              std::size_t size = 0;                                           \
+              for (auto _ : state) {                                          \
+                  auto chunks = strf::to_chunks() __VA_ARGS__;                \
+                  benchmark::DoNotOptimize(chunks.begin());                   \
+                  size = chunks.total_size();                                 \
+              }                                                               \
+              bench_utils::report<char>(state, size);                         \
+          } );
+
+#define STRF_BENCH_APPEND(...)                                               \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( "strf::append " #__VA_ARGS__                                        \
+        , [](benchmark::State& state) {                                       \
+              std::string str;                                                \
+              for (auto _ : state) {                                          \
+                  str.clear();                                                \
+                  strf::append(str) __VA_ARGS__;                              \
+                  benchmark::DoNotOptimize(str.data());                       \
+              }                                                               \
+              bench_utils::report<char>(state, str.size());                   \
+          } );
+
+// Writes records into a ring_buffer, which is consumed
+// ( and the records discarded ) every 64 iterations
+#define STRF_BENCH_TO_RING_BUFFER(...)                                       \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( "strf::to(ring_buffer&) " #__VA_ARGS__                              \
+        , [](benchmark::State& state) {                                       \
+              strf::ring_buffer ring(1 << 20);                                \
+              std::size_t count = 0;                                          \
+              unsigned i = 0;                                                 \
+              for (auto _ : state) {                                          \
+                  count = strf::to(ring) __VA_ARGS__ .count;                  \
+                  if (++i % 64 == 0) {                                        \
+                      ring.consume([](const char*, std::size_t){});           \
+                  }                                                           \
+              }                                                               \
+              bench_utils::report<char>(state, count);                        \
+          } );
+
+#define STRF_BENCH_TO_CFILE_(FUNC, ...)                                      \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( #FUNC "(FILE*) " #__VA_ARGS__                                       \
+        , [](benchmark::State& state) {                                       \
+              std::FILE* file = bench_utils::null_cfile();                    \
+              std::size_t count = 0;                                          \
+              for (auto _ : state) {                                          \
+                  count = FUNC(file) __VA_ARGS__ .count;                      \
+              }                                                               \
+              bench_utils::report<char>(state, count);                        \
+          } );
+
+#define STRF_BENCH_TO_CFILE(...)                                             \
+    STRF_BENCH_TO_CFILE_(strf::to, __VA_ARGS__)
+
+// The same, but using a buffer of BUFF_SIZE characters
+#define STRF_BENCH_TO_CFILE_BUFF(BUFF_SIZE, ...)                             \
+    STRF_BENCH_TO_CFILE_(strf::to<BUFF_SIZE>, __VA_ARGS__)
+
+// The same, but locking the FILE only once per print
+#define STRF_BENCH_TO_LOCKED_CFILE_BUFF(BUFF_SIZE, ...)                      \
+    STRF_BENCH_TO_CFILE_(strf::to_locked<BUFF_SIZE>, __VA_ARGS__)
+
+// Prints many times into the same async_cfile_writer, whose
+// background thread writes into the null device
+#define STRF_BENCH_TO_ASYNC_CFILE(...)                                       \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( "strf::to(async_cfile_writer&) " #__VA_ARGS__                       \
+        , [](benchmark::State& state) {                                       \
+              std::FILE* file = bench_utils::null_cfile();                    \
+              strf::async_cfile_writer<char> writer(file);                    \
+              for (auto _ : state) {                                          \
+                  strf::to(writer) __VA_ARGS__;                               \
+              }                                                               \
+              auto count = writer.finish().count;                             \
+              bench_utils::report<char>(state, count / state.iterations());   \
+          } );
+
+#if ! defined(_WIN32)
+
+#define STRF_BENCH_TO_FD(...)                                                \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( "strf::to_fd(int) " #__VA_ARGS__                                    \
+        , [](benchmark::State& state) {                                       \
+              int fd = bench_utils::null_fd();                                \
+              std::size_t count = 0;                                          \
+              for (auto _ : state) {                                          \
+                  count = strf::to_fd(fd) __VA_ARGS__ .count;                 \
+              }                                                               \
+              bench_utils::report<char>(state, count);                        \
+          } );
+
+#define STRF_BENCH_TO_TMP_FD(...)                                            \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( "strf::to_fd(tmp file) " #__VA_ARGS__                               \
+        , [](benchmark::State& state) {                                       \
+              int fd = bench_utils::tmp_rdwr_fd();                            \
+              std::size_t count = 0;                                          \
+              for (auto _ : state) {                                          \
+                  ::lseek(fd, 0, SEEK_SET);                                   \
+                  count = strf::to_fd(fd) __VA_ARGS__ .count;                 \
+              }                                                               \
+              bench_utils::report<char>(state, count);                        \
+          } );
+
+#define STRF_BENCH_TO_MMAP_FILE(...)                                         \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( "strf::to_mmap_file(tmp file) " #__VA_ARGS__                        \
+        , [](benchmark::State& state) {                                       \
+              int fd = bench_utils::tmp_rdwr_fd();                            \
+              std::size_t count = 0;                                          \
+              for (auto _ : state) {                                          \
+                  count = strf::to_mmap_file(fd) __VA_ARGS__ .count;          \
+              }                                                               \
+              bench_utils::report<char>(state, count);                        \
+          } );
+
+#define STRF_BENCH_TO_URING_TMP_FD(...)                                      \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( "strf::to_uring_fd(tmp file) " #__VA_ARGS__                         \
+        , [](benchmark::State& state) {                                       \
+              int fd = bench_utils::tmp_rdwr_fd();                            \
+              std::size_t count = 0;                                          \
+              for (auto _ : state) {                                          \
+                  ::lseek(fd, 0, SEEK_SET);                                   \
+                  count = strf::to_uring_fd(fd) __VA_ARGS__ .count;           \
+              }                                                               \
+              bench_utils::report<char>(state, count);                        \
+          } );
+
+#else
+
+#define STRF_BENCH_TO_FD(...)
+#define STRF_BENCH_TO_TMP_FD(...)
+#define STRF_BENCH_TO_MMAP_FILE(...)
+#define STRF_BENCH_TO_URING_TMP_FD(...)
+
+#endif // ! defined(_WIN32)
+
+#define STRF_BENCH_TO_STREAMBUF(...)                                         \
+    static auto* const STRF_BENCH_REGISTRAR_ = benchmark::RegisterBenchmark   \
+        ( "strf::to(std::streambuf&) " #__VA_ARGS__                           \
+        , [](benchmark::State& state) {                                       \
+              bench_utils::null_streambuf<char> sbuf;                         \
+              std::streamsize count = 0;                                      \
+              for (auto _ : state) {                                          \
+                  count = strf::to(sbuf) __VA_ARGS__ .count;                  \
+              }                                                               \
+              bench_utils::report<char>(state, count);                        \
+          } );
+
+#endif  // STRF_BENCHMARKS_BENCHMARK_UTILS_HPP_INCLUDED
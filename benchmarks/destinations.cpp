@@ -0,0 +1,112 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "benchmark_utils.hpp"
+#include <vector>
+
+// Compares the destinations, and the tr-string syntax ( parsed at
+// run-time, pre-parsed by strf::tr_template, and parsed at compile-time )
+// against the plain syntax, for a same set of arguments
+
+int int_value = 123456;
+long long longlong_value = 1234567890123456789LL;
+double double_value = 1.1234567890123456;
+const char* short_str = "Hello World";
+std::string medium_str(300, 'x');
+std::string long_str(1000, 'x');
+std::string huge_str(16000, 'x');
+std::vector<int> many_ints(500000, 1234567);
+strf::numpunct<10> punct_dec_3 = strf::numpunct<10>{3};
+const strf::tr_template<char> tmpl_4_args("{} -- {} -- {} -- {}");
+const strf::tr_template<char> tmpl_2_args("{1} -- {0} -- {1} -- {0}");
+const strf::tr_template<char> tmpl_3_args("{} {} {}");
+
+#define STRF_BENCH_ALL_DESTINATIONS(...)   \
+    STRF_BENCH_TO_CHAR_PTR(__VA_ARGS__)    \
+    STRF_BENCH_TO_STRING(__VA_ARGS__)      \
+    STRF_BENCH_APPEND(__VA_ARGS__)         \
+    STRF_BENCH_TO_CFILE(__VA_ARGS__)       \
+    STRF_BENCH_TO_FD(__VA_ARGS__)          \
+    STRF_BENCH_TO_STREAMBUF(__VA_ARGS__)
+
+STRF_BENCH_ALL_DESTINATIONS( (short_str) )
+STRF_BENCH_ALL_DESTINATIONS( (long_str) )
+STRF_BENCH_ALL_DESTINATIONS( (int_value) )
+STRF_BENCH_ALL_DESTINATIONS( (strf::hex(longlong_value)) )
+STRF_BENCH_ALL_DESTINATIONS( .with(punct_dec_3) (strf::punct(longlong_value)) )
+STRF_BENCH_ALL_DESTINATIONS( (double_value) )
+STRF_BENCH_ALL_DESTINATIONS( (strf::fixed(double_value, 6)) )
+STRF_BENCH_ALL_DESTINATIONS( (strf::sani(short_str)) )
+STRF_BENCH_ALL_DESTINATIONS( (strf::right(short_str, 20)) )
+STRF_BENCH_ALL_DESTINATIONS( (short_str, ' ', int_value, ' ', double_value) )
+STRF_BENCH_ALL_DESTINATIONS
+    ( .tr("{} {} {}", short_str, int_value, double_value) )
+STRF_BENCH_ALL_DESTINATIONS
+    ( (short_str, " -- ", int_value, " -- ", double_value, " -- ", strf::hex(int_value)) )
+STRF_BENCH_ALL_DESTINATIONS
+    ( .tr("{} -- {} -- {} -- {}", short_str, int_value, double_value, strf::hex(int_value)) )
+STRF_BENCH_ALL_DESTINATIONS
+    ( .tr("{1} -- {0} -- {1} -- {0}", short_str, int_value) )
+STRF_BENCH_ALL_DESTINATIONS
+    ( .tr(tmpl_4_args, short_str, int_value, double_value, strf::hex(int_value)) )
+STRF_BENCH_ALL_DESTINATIONS
+    ( .tr(tmpl_2_args, short_str, int_value) )
+STRF_BENCH_ALL_DESTINATIONS
+    ( .tr(STRF_TR("{} -- {} -- {} -- {}"), short_str, int_value, double_value, strf::hex(int_value)) )
+STRF_BENCH_ALL_DESTINATIONS
+    ( .tr(STRF_TR("{1} -- {0} -- {1} -- {0}"), short_str, int_value) )
+
+// to(FILE*) with its default buffer, with a bigger buffer, and
+// locking the FILE only once
+STRF_BENCH_TO_CFILE( (int_value, ' ', medium_str, ' ', double_value, '\n') )
+STRF_BENCH_TO_CFILE_BUFF(512, (int_value, ' ', medium_str, ' ', double_value, '\n') )
+STRF_BENCH_TO_LOCKED_CFILE_BUFF(512, (int_value, ' ', medium_str, ' ', double_value, '\n') )
+
+// The same, but leaving the writing to a background thread
+STRF_BENCH_TO_ASYNC_CFILE( (int_value, ' ', medium_str, ' ', double_value, '\n') )
+
+// A log line written directly into a shared ring_buffer
+STRF_BENCH_TO_RING_BUFFER( (int_value, ' ', medium_str, ' ', double_value, '\n') )
+STRF_BENCH_TO_RING_BUFFER( .reserve_calc() (int_value, ' ', medium_str, ' ', double_value, '\n') )
+
+// Large payloads. to_fd passes them to writev together with
+// the buffered content, instead of copying them into its buffer
+STRF_BENCH_TO_CFILE( (short_str, huge_str, short_str) )
+STRF_BENCH_TO_FD( (short_str, huge_str, short_str) )
+
+// Writing a few megabytes into a regular file
+STRF_BENCH_TO_TMP_FD( (strf::separated_range(many_ints, ",")) )
+STRF_BENCH_TO_URING_TMP_FD( (strf::separated_range(many_ints, ",")) )
+STRF_BENCH_TO_MMAP_FILE( (strf::separated_range(many_ints, ",")) )
+STRF_BENCH_TO_MMAP_FILE( .reserve_calc() (strf::separated_range(many_ints, ",")) )
+
+// Medium strings: to_pooled_string writes into a reused scratch
+// buffer and allocates the resulting string only once
+STRF_BENCH_TO_STRING( (int_value, ' ', medium_str, ' ', double_value) )
+STRF_BENCH_TO_POOLED_STRING( (int_value, ' ', medium_str, ' ', double_value) )
+STRF_BENCH_TO_POOLED_STRING( (long_str, ' ', int_value, ' ', double_value) )
+
+// Building a few megabytes in memory: to_string reallocates and
+// moves the content as it grows, while to_chunks never moves it
+STRF_BENCH_TO_STRING( (strf::separated_range(many_ints, ",")) )
+STRF_BENCH_TO_CHUNKS( (strf::separated_range(many_ints, ",")) )
+
+// to_string without and with size pre-calculation
+STRF_BENCH_TO_STRING( (long_str, ' ', int_value, ' ', double_value) )
+STRF_BENCH_TO_STRING( .reserve_calc() (long_str, ' ', int_value, ' ', double_value) )
+STRF_BENCH_TO_STRING( .reserve(1100) (long_str, ' ', int_value, ' ', double_value) )
+STRF_BENCH_TO_STRING( .reserve_calc() .tr("{} {} {}", long_str, int_value, double_value) )
+STRF_BENCH_TO_STRING( .reserve_calc() .tr(tmpl_3_args, long_str, int_value, double_value) )
+STRF_BENCH_TO_STRING( .reserve_calc() .tr(STRF_TR("{} {} {}"), long_str, int_value, double_value) )
+
+// Size pre-calculation with print_preview versus a dry run into
+// strf::size_counter, which prints everything twice
+STRF_BENCH_TO_STRING( .reserve_calc() (short_str, ' ', int_value, ' ', double_value) )
+STRF_BENCH_TO_STRING( .reserve_calc_by_dry_run() (short_str, ' ', int_value, ' ', double_value) )
+STRF_BENCH_TO_STRING( .reserve_calc_by_dry_run() (long_str, ' ', int_value, ' ', double_value) )
+STRF_BENCH_TO_STRING( .reserve_calc() (strf::separated_range(many_ints, ",")) )
+STRF_BENCH_TO_STRING( .reserve_calc_by_dry_run() (strf::separated_range(many_ints, ",")) )
+
+BENCHMARK_MAIN();
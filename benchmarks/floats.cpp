@@ -0,0 +1,56 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "benchmark_utils.hpp"
+
+double double_value = 1.1234567890123456;
+double big_double = 1.234567890123456e+250;
+double small_double = 1.234567890123456e-250;
+double round_double = 1000.5;
+double integral_double = 1234567890.0;
+float float_value = 1.12345678f;
+
+strf::numpunct<10> punct_dec_3 = strf::numpunct<10>{3};
+strf::numpunct<10> punct_dec_big_sep
+    = strf::numpunct<10>{3}.thousands_sep(0x2022).decimal_point(0x066B);
+
+// shortest representation
+STRF_BENCH_TO_CHAR_PTR( (double_value) )
+STRF_BENCH_TO_CHAR_PTR( (big_double) )
+STRF_BENCH_TO_CHAR_PTR( (small_double) )
+STRF_BENCH_TO_CHAR_PTR( (round_double) )
+STRF_BENCH_TO_CHAR_PTR( (float_value) )
+STRF_BENCH_TO_CHAR_PTR( (double_value, ' ', big_double, ' ', small_double) )
+STRF_BENCH_TO_CHAR_PTR( (+strf::fmt(double_value) > 30) )
+
+// fixed notation
+STRF_BENCH_TO_CHAR_PTR( (strf::fixed(double_value)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::fixed(round_double)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::fixed(double_value, 6)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::fixed(double_value, 20)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::fixed(float_value, 6)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::fixed(small_double, 6)) )
+
+// scientific notation
+STRF_BENCH_TO_CHAR_PTR( (strf::sci(double_value)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::sci(big_double)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::sci(double_value, 6)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::sci(big_double, 20)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::sci(float_value, 6)) )
+
+// general notation
+STRF_BENCH_TO_CHAR_PTR( (strf::gen(double_value)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::gen(double_value, 6)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::gen(big_double, 6)) )
+STRF_BENCH_TO_CHAR_PTR( (*strf::gen(round_double, 20)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::gen(float_value, 6)) )
+
+// with punctuation
+STRF_BENCH_TO_CHAR_PTR( .with(punct_dec_3) (strf::punct(round_double)) )
+STRF_BENCH_TO_CHAR_PTR( .with(punct_dec_3) (strf::punct(integral_double)) )
+STRF_BENCH_TO_CHAR_PTR( .with(punct_dec_3) (strf::punct(strf::fixed(big_double, 2))) )
+STRF_BENCH_TO_CHAR_PTR( .with(punct_dec_big_sep) (strf::punct(strf::fixed(1e+20, 2))) )
+
+BENCHMARK_MAIN();
@@ -0,0 +1,120 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "benchmark_utils.hpp"
+#include <vector>
+
+// The values are kept in non-const variables with external linkage
+// so that the compiler can not pre-compute the results.
+
+int small_int = 25;
+int int_value = 123456;
+int negative_int = -654321;
+long long longlong_value = 1234567890123456789LL;
+unsigned long long ulonglong_max = 0xFFFFFFFFFFFFFFFFULL;
+#if defined(STRF_HAS_INT128)
+strf::detail::uint128_t uint128_value = (strf::detail::uint128_t)ulonglong_max * 12345678901234567ULL;
+strf::detail::int128_t negative_int128 = -(strf::detail::int128_t)longlong_value * 1234567890123ULL;
+#endif
+
+// Values whose number of digits varies unpredictably,
+// so that the branch predictor can not learn it
+template <typename UIntT>
+std::vector<UIntT> make_random_magnitude_values(std::size_t count)
+{
+    std::vector<UIntT> values;
+    unsigned long long seed = 0x2545F4914F6CDD1DULL;
+    for (std::size_t i = 0; i < count; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const unsigned bits = 1 + (unsigned)(seed >> 58) % (sizeof(UIntT) * 8);
+        const unsigned long long mask = ~0ULL >> (64 - bits);
+        values.push_back(static_cast<UIntT>((seed ^ (seed >> 29)) & mask));
+    }
+    return values;
+}
+
+std::vector<unsigned> random_magnitude_uints = make_random_magnitude_values<unsigned>(200);
+std::vector<unsigned long long> random_magnitude_ulls
+    = make_random_magnitude_values<unsigned long long>(150);
+
+std::vector<unsigned char> make_random_bytes(std::size_t count)
+{
+    std::vector<unsigned char> bytes;
+    unsigned long long seed = 0x9E3779B97F4A7C15ULL;
+    for (std::size_t i = 0; i < count; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        bytes.push_back(static_cast<unsigned char>(seed >> 56));
+    }
+    return bytes;
+}
+
+std::vector<unsigned char> random_bytes = make_random_bytes(4096);
+
+strf::numpunct<10> punct_dec_3 = strf::numpunct<10>{3};
+strf::numpunct<10> punct_dec_big_sep
+    = strf::numpunct<10>{3}.thousands_sep(0x2022);
+strf::numpunct<10> punct_dec_non_uniform = strf::numpunct<10>{3, 2, 1};
+strf::numpunct<16> punct_hex_4 = strf::numpunct<16>{4}.thousands_sep('\'');
+strf::numpunct<8>  punct_oct_3 = strf::numpunct<8>{3}.thousands_sep('_');
+strf::numpunct<2>  punct_bin_8 = strf::numpunct<2>{8}.thousands_sep('\'');
+
+// decimal
+STRF_BENCH_TO_CHAR_PTR( (small_int) )
+STRF_BENCH_TO_CHAR_PTR( (int_value) )
+STRF_BENCH_TO_CHAR_PTR( (negative_int) )
+STRF_BENCH_TO_CHAR_PTR( (longlong_value) )
+STRF_BENCH_TO_CHAR_PTR( (ulonglong_max) )
+STRF_BENCH_TO_CHAR_PTR( (int_value, ' ', negative_int, ' ', longlong_value) )
+STRF_BENCH_TO_CHAR_PTR( (+strf::dec(int_value) > 20) )
+STRF_BENCH_TO_CHAR_PTR( (strf::dec(int_value).p(20)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::right(int_value, 20, '*')) )
+STRF_BENCH_TO_CHAR_PTR( (strf::separated_range(random_magnitude_uints, " ")) )
+STRF_BENCH_TO_CHAR_PTR( (strf::separated_range(random_magnitude_ulls, " ")) )
+#if defined(STRF_HAS_INT128)
+STRF_BENCH_TO_CHAR_PTR( (uint128_value) )
+STRF_BENCH_TO_CHAR_PTR( (negative_int128) )
+STRF_BENCH_TO_CHAR_PTR( (ulonglong_max, ulonglong_max) )
+STRF_BENCH_TO_CHAR_PTR( (strf::right(uint128_value, 50, '*')) )
+#endif
+
+// decimal with punctuation
+STRF_BENCH_TO_CHAR_PTR( .with(punct_dec_3) (strf::punct(int_value)) )
+STRF_BENCH_TO_CHAR_PTR( .with(punct_dec_3) (strf::punct(longlong_value)) )
+STRF_BENCH_TO_CHAR_PTR( .with(punct_dec_3) (strf::punct(ulonglong_max)) )
+#if defined(STRF_HAS_INT128)
+STRF_BENCH_TO_CHAR_PTR( .with(punct_dec_3) (strf::punct(uint128_value)) )
+#endif
+STRF_BENCH_TO_CHAR_PTR( .with(punct_dec_big_sep) (strf::punct(longlong_value)) )
+STRF_BENCH_TO_CHAR_PTR( .with(punct_dec_non_uniform) (strf::punct(longlong_value)) )
+STRF_BENCH_TO_CHAR_PTR( .with(punct_dec_3) (strf::punct(longlong_value) > 30) )
+
+// hexadecimal
+STRF_BENCH_TO_CHAR_PTR( (strf::hex(int_value)) )
+STRF_BENCH_TO_CHAR_PTR( (*strf::hex(ulonglong_max)) )
+STRF_BENCH_TO_CHAR_PTR( .with(strf::uppercase) (*strf::hex(ulonglong_max)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::hex(int_value).p(16) > 20) )
+STRF_BENCH_TO_CHAR_PTR( .with(punct_hex_4) (strf::punct(strf::hex(ulonglong_max))) )
+STRF_BENCH_TO_CHAR_PTR( (strf::fmt_separated_range(random_magnitude_ulls, " ").hex()) )
+
+// hexadecimal dump
+STRF_BENCH_TO_CHAR_PTR( (strf::range( random_bytes.data(), random_bytes.data() + 1024
+                                    , [](unsigned char b){ return strf::hex(b).pad0(2); } )) )
+STRF_BENCH_TO_CHAR_PTR( (strf::hex_bytes(random_bytes.data(), 1024)) )
+STRF_BENCH_TO_CHAR_PTR( .with(strf::uppercase) (strf::hex_bytes(random_bytes.data(), 1024)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::hex_bytes(random_bytes.data(), 1024, ' ')) )
+STRF_BENCH_TO_STRING( (strf::hex_bytes(random_bytes.data(), random_bytes.size())) )
+
+// octal
+STRF_BENCH_TO_CHAR_PTR( (strf::oct(int_value)) )
+STRF_BENCH_TO_CHAR_PTR( (*strf::oct(ulonglong_max)) )
+STRF_BENCH_TO_CHAR_PTR( .with(punct_oct_3) (strf::punct(strf::oct(ulonglong_max))) )
+
+// binary
+STRF_BENCH_TO_CHAR_PTR( (strf::bin(int_value)) )
+STRF_BENCH_TO_CHAR_PTR( (*strf::bin(ulonglong_max)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::fmt_separated_range(random_magnitude_uints, " ").bin()) )
+STRF_BENCH_TO_CHAR_PTR( .with(punct_bin_8) (strf::punct(strf::bin(ulonglong_max))) )
+
+BENCHMARK_MAIN();
@@ -0,0 +1,34 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "benchmark_utils.hpp"
+#include <vector>
+
+int int_value = 123456;
+double double_value = 1.25;
+const char* str = "Hello World";
+int int_array[] = {11, 22, 33, 44, 55, 66, 77, 88, 99, 1000};
+std::vector<std::string> str_vector = {"one", "two", "three", "four", "five"};
+
+// joins
+STRF_BENCH_TO_CHAR_PTR( (strf::join(str, ' ', int_value, ' ', double_value)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::join_left(40)(str, ' ', int_value)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::join_right(40, U'.')(str, ' ', int_value)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::join_center(40, U'\u2022')(str, ' ', int_value)) )
+STRF_BENCH_TO_CHAR_PTR
+    ( (strf::join_right(50)
+        ( "[", strf::join_center(30)(str, ' ', strf::hex(int_value)), "]" )) )
+
+// ranges
+STRF_BENCH_TO_CHAR_PTR( (strf::range(int_array)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::separated_range(int_array, ", ")) )
+STRF_BENCH_TO_CHAR_PTR( (*strf::hex(strf::separated_range(int_array, ", ")).p(4)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::fmt_separated_range(int_array, " / ") > 6) )
+STRF_BENCH_TO_CHAR_PTR( (strf::separated_range(str_vector, ", ")) )
+STRF_BENCH_TO_CHAR_PTR
+    ( (strf::separated_range(int_array, ", ", [](int x){ return strf::hex(x * 2); })) )
+STRF_BENCH_TO_CHAR_PTR( (strf::join_center(80)(strf::separated_range(int_array, ", "))) )
+
+BENCHMARK_MAIN();
@@ -0,0 +1,75 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "benchmark_utils.hpp"
+
+const char* short_str = "Hello World";
+std::string long_str(1000, 'x');
+const char* u8str_mb = "\xC3\xA1\xC3\xA9\xC3\xAD\xC3\xB3\xC3\xBA \xE2\x82\xAC \xF0\x9F\x98\x80 ascii";
+const char* u8str_invalid = "abc \xC3 def \xFF ghi \xED\xA0\x80 jkl";
+const char16_t* u16str = u"Hello World \u00E1\u00E9\u00ED \u20AC \U0001F600";
+const char32_t* u32str = U"Hello World \u00E1\u00E9\u00ED \u20AC \U0001F600";
+const char* latin1_str = "Hello World \xE1\xE9\xED\xF3\xFA";
+std::u16string long_u16str(1000, u'x');
+std::u32string long_u32str(1000, U'x');
+std::string long_u8str_mb = [](){
+    std::string str;
+    while (str.size() < 1000) {
+        str += "Hello World \xC3\xA1\xC3\xA9\xC3\xAD \xE2\x82\xAC \xF0\x9F\x98\x80 ";
+    }
+    return str;
+}();
+
+// plain copy
+STRF_BENCH_TO_CHAR_PTR( (short_str) )
+STRF_BENCH_TO_CHAR_PTR( (long_str) )
+STRF_BENCH_TO_CHAR_PTR( (short_str, ' ', short_str, ' ', short_str) )
+
+// aligned
+STRF_BENCH_TO_CHAR_PTR( (strf::right(short_str, 20)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::center(short_str, 20, U'\u2022')) )
+STRF_BENCH_TO_CHAR_PTR( (strf::left(u8str_mb, 40)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::right(long_str, 1010)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::fmt(short_str).p(5) > 20) )
+
+// conversion to UTF-8
+STRF_BENCH_TO_CHAR_PTR( (strf::conv(u16str)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::conv(u32str)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::conv(long_u16str)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::conv(latin1_str, strf::iso_8859_1<char>)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::conv(latin1_str, strf::windows_1252<char>)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::right(strf::conv(u16str), 40)) )
+
+// conversion from UTF-8
+STRF_BENCH_TO_CHAR16_PTR( (strf::conv(short_str)) )
+STRF_BENCH_TO_CHAR16_PTR( (strf::conv(u8str_mb)) )
+STRF_BENCH_TO_CHAR16_PTR( (strf::conv(long_str)) )
+STRF_BENCH_TO_CHAR32_PTR( (strf::conv(short_str)) )
+STRF_BENCH_TO_CHAR32_PTR( (strf::conv(u8str_mb)) )
+STRF_BENCH_TO_CHAR32_PTR( (strf::conv(long_str)) )
+
+// conversion between single byte charsets
+STRF_BENCH_TO_CHAR_PTR
+    ( .with(strf::iso_8859_1<char>)
+      (strf::conv(latin1_str, strf::windows_1252<char>)) )
+STRF_BENCH_TO_CHAR_PTR
+    ( .with(strf::iso_8859_15<char>)
+      (strf::conv(u8str_mb, strf::utf8<char>)) )
+
+// conversion from UTF-32 to single byte charsets
+STRF_BENCH_TO_CHAR_PTR( .with(strf::windows_1252<char>) (strf::conv(u32str)) )
+STRF_BENCH_TO_CHAR_PTR( .with(strf::iso_8859_2<char>) (strf::conv(u32str)) )
+STRF_BENCH_TO_CHAR_PTR( .with(strf::windows_1250<char>) (strf::conv(long_u32str)) )
+
+// sanitization
+STRF_BENCH_TO_CHAR_PTR( (strf::sani(short_str)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::sani(u8str_mb)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::sani(u8str_invalid)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::sani(long_str)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::sani(long_u8str_mb)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::sani(latin1_str, strf::iso_8859_1<char>)) )
+STRF_BENCH_TO_CHAR_PTR( (strf::right(strf::sani(u8str_mb), 40)) )
+
+BENCHMARK_MAIN();
@@ -41,6 +41,7 @@
 #include <strf/detail/printable_types/join.hpp>
 #include <strf/detail/printable_types/facets_pack.hpp>
 #include <strf/detail/printable_types/range.hpp>
+#include <strf/detail/printable_types/hex_bytes.hpp>
 
 
 #if defined(_MSC_VER)
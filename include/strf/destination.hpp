@@ -493,6 +493,70 @@ private:
 template <typename CharT>
 using discarded_outbuff = discarded_destination<CharT>;
 
+namespace detail {
+
+// Larger than garbage_buff, so that size_counter::recycle
+// is called less often
+template <typename CharT>
+inline STRF_HD CharT* size_counter_buff() noexcept
+{
+    static CharT arr[ 8 * STRF_MIN_SPACE_AFTER_RECYCLE ];
+    return arr;
+}
+
+template <typename CharT>
+inline STRF_HD CharT* size_counter_buff_end() noexcept
+{
+    return strf::detail::size_counter_buff<CharT>()
+        + 8 * strf::min_space_after_recycle<CharT>();
+}
+
+} // namespace detail
+
+// Counts the characters written into it, but discards them
+template <typename CharT>
+class size_counter final
+    : public strf::destination<CharT>
+{
+public:
+
+    STRF_HD size_counter() noexcept
+        : destination<CharT>
+            { strf::detail::size_counter_buff<CharT>()
+            , strf::detail::size_counter_buff_end<CharT>() }
+    {
+    }
+
+    STRF_HD ~size_counter()
+    {
+    }
+
+    STRF_HD void recycle() noexcept override
+    {
+        count_ += this->buffer_ptr() - strf::detail::size_counter_buff<CharT>();
+        this->set_buffer_ptr(strf::detail::size_counter_buff<CharT>());
+    }
+
+    STRF_HD std::size_t count() const noexcept
+    {
+        return count_ + (this->buffer_ptr() - strf::detail::size_counter_buff<CharT>());
+    }
+
+    STRF_HD std::size_t finish() noexcept
+    {
+        return count();
+    }
+
+private:
+
+    STRF_HD void do_write(const CharT*, std::size_t str_len) noexcept override
+    {
+        count_ += str_len;
+    }
+
+    std::size_t count_ = 0;
+};
+
 } // namespace strf
 
 #if defined(__GNUC__)
@@ -0,0 +1,1000 @@
+#ifndef STRF_DETAIL_CH32_WIDTH_AND_GCB_PROP_HPP
+#define STRF_DETAIL_CH32_WIDTH_AND_GCB_PROP_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This file was generated by tools/generate_ch32_width_and_gcb_prop.cpp
+// from the data of ICU 72.1 ( Unicode 15.0 ). Do not edit it manually.
+
+#include <strf/detail/strf_def.hpp>
+#include <cstdint>
+
+namespace strf {
+namespace detail {
+
+// Values returned by ch32_width_and_gcb_prop. The four lowest bits
+// contain the Grapheme_Cluster_Break property, except that
+// extended_picto is used for the Extended_Pictographic code points.
+// The bit `wide` is set when the width of the code point is 2.
+namespace gcb_prop {
+
+constexpr unsigned other              = 0;
+constexpr unsigned extend             = 1;
+constexpr unsigned control            = 2;
+constexpr unsigned cr                 = 3;
+constexpr unsigned lf                 = 4;
+constexpr unsigned spacing_mark       = 5;
+constexpr unsigned prepend            = 6;
+constexpr unsigned hangul_l           = 7;
+constexpr unsigned hangul_v           = 8;
+constexpr unsigned hangul_t           = 9;
+constexpr unsigned hangul_lv          = 10;
+constexpr unsigned hangul_lvt         = 11;
+constexpr unsigned regional_indicator = 12;
+constexpr unsigned zwj                = 13;
+constexpr unsigned extended_picto     = 14;
+constexpr unsigned category_mask      = 0x0F;
+constexpr unsigned wide               = 0x10;
+
+} // namespace gcb_prop
+
+#if ! defined(STRF_OMIT_IMPL)
+
+STRF_FUNC_IMPL STRF_HD unsigned ch32_width_and_gcb_prop(char32_t ch) noexcept
+{
+    static const std::uint8_t stage1[] =
+        {   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  10
+          ,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  30,  31,  32
+          ,  33,  34,  35,  36,  30,  31,  32,  33,  34,  35,  36,  37,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  38,  39,  10,  40
+          ,  41,  42,  10,  10,  10,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  54,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  55,  10,  56,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  57,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  58,  59,  60,  10,  10,  10,  61,  10,  10
+          ,  62,  63,  64,  10,  65,  10,  10,  10,  66,  67,  68,  69,  70,  71,  72,  73
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  74
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25
+          ,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  74
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  75,  76,  76,  76,  76,  76,  76,  76,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10
+          ,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10,  10 };
+    static const std::uint16_t stage2[][32] =
+        { /* 0 */
+          {   0,   1,   2,   2,   2,   2,   2,   3,   1,   1,   4,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 1 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   5,   5,   5,   5,   5,   5,   5,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 2 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   6,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   7,   5,   8,   9,   2,   2,   2 }
+        , /* 3 */
+          {  10,  11,   2,   2,  12,   5,   2,  13,   2,   2,   2,   2,   2,  14,  15,   2
+          ,  16,  17,   2,   5,  18,   2,   2,   2,   2,   2,  19,  13,   2,   2,  12,  20 }
+        , /* 4 */
+          {   2,  21,  22,   2,   2,  23,   2,   2,   2,  24,   2,   2,  25,   5,  26,   5
+          ,  27,   2,   2,  28,  29,  30,  31,   2,  32,   2,   2,  33,  34,  35,  31,  36 }
+        , /* 5 */
+          {  37,   2,   2,  38,  39,  17,   2,  40,  37,   2,   2,  38,  41,   2,  31,  25
+          ,  32,   2,   2,  42,  34,  43,  31,   2,  44,   2,   2,  45,  46,  35,   2,   2 }
+        , /* 6 */
+          {  47,   2,   2,  42,  48,  49,  31,   2,  32,   2,   2,  50,  51,  49,  31,  52
+          ,  53,   2,   2,  54,  55,  35,  31,   2,  32,   2,   2,   2,  56,  57,   2,  58 }
+        , /* 7 */
+          {   2,   2,   2,  59,  60,   2,   2,   2,   2,   2,   2,  61,  62,   2,   2,   2
+          ,   2,  63,   2,  64,   2,   2,   2,  65,  66,  67,   5,  68,  69,   2,   2,   2 }
+        , /* 8 */
+          {   2,   2,  70,  71,   2,  72,  13,  73,  74,  75,   2,   2,   2,   2,   2,   2
+          ,  76,  76,  76,  76,  76,  76,  77,  77,  77,  77,  78,  79,  79,  79,  79,  79 }
+        , /* 9 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2,   2,  70,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 10 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 11 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2,  80,   2,  81,   2,  31,   2,  31,   2,   2,   2,  82,  83,  20,   2,   2 }
+        , /* 12 */
+          {  84,   2,   2,   2,   2,   2,   2,   2,  49,   2,  85,   2,   2,   2,   2,   2
+          ,   2,   2,  86,  87,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 13 */
+          {   2,  88,   2,   2,   2,  89,  90,  91,   2,   2,   2,   5,  92,   2,   2,   2
+          ,  93,   2,   2,  94,  95,   2,  12,  96,  97,   2,  98,   2,   2,   2,  99,  53 }
+        , /* 14 */
+          {   2,   2, 100, 101,   2,   2,   2,   2,   2,   2,   2,   2,   2, 102, 103, 104
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   5,   5,   5,   5 }
+        , /* 15 */
+          { 105,   2, 106, 107, 108,   2,   1,   2,   2,   2,   2,   2,   2,   5,   5,  13
+          ,   2,   2, 109, 108,   2,   2,   2,   2,   2, 110, 111,   2,   2,   2,   2,   2 }
+        , /* 16 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2, 112, 113,   2,   2,   2,   2,   2, 114,   2,   2,   2, 115,   2, 116, 117 }
+        , /* 17 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 109,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 112, 118, 119,   2,   2, 120 }
+        , /* 18 */
+          { 121, 122, 123, 123, 123, 123, 123, 123, 124, 123, 123, 123, 123, 123, 123, 123
+          , 125, 126, 127, 128, 129, 130, 131,   2,   2, 132, 133, 134,   2,   2,   2,   2 }
+        , /* 19 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2, 135,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 20 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          , 132, 136,   2,   2,   2, 137,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 21 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 138, 139
+          ,   2,   2,   2,   2,   2,   2,   2, 138,   2,   2,   2,   2,   2,   2,   5,   5 }
+        , /* 22 */
+          {   2,   2,   2,   2,   2,   2,   2,   2, 140, 140, 140, 140, 140, 140, 140, 140
+          , 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140 }
+        , /* 23 */
+          { 140, 140, 141, 142, 140, 140, 140, 140, 140, 143, 140, 140, 140, 140, 140, 140
+          , 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140 }
+        , /* 24 */
+          { 140, 140, 140, 140, 140, 140, 140, 140, 140, 144, 140, 140, 140, 140, 140, 140
+          , 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140 }
+        , /* 25 */
+          { 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140
+          , 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140 }
+        , /* 26 */
+          { 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 27 */
+          {   2,   2,   2,   2,   2,   2, 138, 145,   2, 146,   2,   2,   2,   2,   2, 139
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 28 */
+          { 147,   2, 148,   2,   2,   2,   2,   2, 149,   2,   2, 150, 151,   2,   5, 152
+          ,   2,   2, 153,   2, 154,  53, 155, 156,  27,   2,   2, 157, 158,   2, 159,   2 }
+        , /* 29 */
+          {   2,   2, 160, 161, 162,   2,   2, 163,   2,   2,   2, 164,  17,   2, 165, 166
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 167,   2 }
+        , /* 30 */
+          { 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169
+          , 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171 }
+        , /* 31 */
+          { 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172
+          , 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168 }
+        , /* 32 */
+          { 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170
+          , 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170 }
+        , /* 33 */
+          { 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170
+          , 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169 }
+        , /* 34 */
+          { 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171
+          , 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172 }
+        , /* 35 */
+          { 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168
+          , 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170 }
+        , /* 36 */
+          { 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170
+          , 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170 }
+        , /* 37 */
+          { 168, 169, 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 172, 170, 168, 169
+          , 170, 171, 170, 172, 170, 168, 169, 170, 171, 170, 173,  77, 174,  79,  79, 175 }
+        , /* 38 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          , 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140 }
+        , /* 39 */
+          { 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140
+          ,   2,  36,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 40 */
+          {   5, 176,   5, 140, 140, 140, 140,   2,   2,   2,   2,   2,   2,   2,   2,   3
+          , 140, 140, 140, 140, 140, 140, 177,   2,   2, 146,   2,   2,   2,   2, 178, 179 }
+        , /* 41 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,  75 }
+        , /* 42 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,  13,   2
+          ,   2,   2,   2,   2,   2,   2,   2, 180,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 43 */
+          { 181,   2,   2, 182,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,  49,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 44 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2, 183,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 45 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 184,   2,   2,   2,   2,  70
+          ,   2,   2,   2,   2,  19,  13,   2,   2, 185,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 46 */
+          { 186,   2,   2, 187, 188,   2,   2, 189,  97,   2,   2, 190, 191,   2,   2,   2
+          , 192,   2, 193, 194, 195,   2,   2, 196,  97,   2,   2, 197, 198,   2,   2,   2 }
+        , /* 47 */
+          {   2,   2, 199, 200,  17,   2,   2,   2,   2,   2,   2,   2,   2, 138, 201,   2
+          ,  53,   2,   2,  54, 202,  35, 203, 194,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 48 */
+          {   2,   2,   2, 204, 205,  36,   2,   2,   2,   2,   2, 206, 207,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 138, 208,  13, 209,   2,   2 }
+        , /* 49 */
+          {   2,   2,   2, 210,  13,   2,   2,   2,   2,   2, 211, 212,   2,   2,   2,   2
+          ,   2,  70, 213,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 50 */
+          {   2,   2, 199, 214,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2, 215, 216,   2,   2,   2,   2,   2,   2,   2,   2, 217, 218,   2 }
+        , /* 51 */
+          { 219,   2,   2, 220,  35, 221,   2,   2, 222, 223,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 52 */
+          {   2,   2, 224, 225,   2,   2,   2,   2,   2, 226, 227, 228,   2,   2,   2,   2
+          ,   2,   2,   2, 229, 230,   2,   2,   2, 231, 232,   2,   2,   2,   2,   2,   2 }
+        , /* 53 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 233
+          , 234,   2,   2, 235, 236,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 54 */
+          {   2,   2,   2,   1, 237, 238,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 55 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 194
+          ,   2,   2,   2, 188,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 56 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2, 138, 239, 240, 240, 241, 192,   2,   2,   2,   2, 242, 149 }
+        , /* 57 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2, 243, 244,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 58 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   5,   5, 245,   5, 188,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 59 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2, 246, 247, 248,   2, 249,   2,   2,   2,   2,   2 }
+        , /* 60 */
+          {   2,   2,   2,   2, 250,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 61 */
+          {   5,   5,   5, 251,   5,   5,  68, 159, 242,  12,   7,   2,   2,   2,   2,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 62 */
+          { 252, 253, 254,   2,   2,   2,   2,   2, 138,   2,   2,   2,   2,   2,   2,   2
+          ,   2,   2,   2, 188,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 63 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,  36,   2,   2,   2, 255,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 64 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 255,   2
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 65 */
+          {   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 188,   2,   2
+          ,   2,   2,   2,   2, 256,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 66 */
+          { 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123
+          , 257,   2, 115,   2,   2,   2, 258, 259, 260, 261, 257, 123, 123, 123, 262, 263 }
+        , /* 67 */
+          { 264, 265, 115, 266, 116, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123
+          , 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 268 }
+        , /* 68 */
+          { 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267
+          , 267, 267, 267, 269, 270, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267 }
+        , /* 69 */
+          { 267, 267, 267, 267, 267,   2,   2,   2, 123, 123, 123, 123, 123, 123, 123, 123
+          ,   2,   2,   2,   2,   2,   2,   2, 271,   2,   2,   2,   2,   2, 272, 123, 123 }
+        , /* 70 */
+          { 258,   2,   2,   2, 273, 274,   2,   2, 273,   2, 275, 123, 123, 123, 123, 123
+          , 276, 267, 267, 277, 278, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267 }
+        , /* 71 */
+          { 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123
+          ,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2 }
+        , /* 72 */
+          { 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123
+          , 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123 }
+        , /* 73 */
+          { 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123
+          , 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 279 }
+        , /* 74 */
+          { 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140
+          , 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 280 }
+        , /* 75 */
+          {   1,   1,   5,   5,   5,   5,   5,   5,   1,   1,   1,   1,   1,   1,   1,   1
+          ,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   1 }
+        , /* 76 */
+          {   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1
+          ,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1 }
+        };
+    static const std::uint8_t stage3[][16] =
+        { /* 0 */
+          {  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  4,  2,  2,  3,  2,  2 }
+        , /* 1 */
+          {  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2 }
+        , /* 2 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 3 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2 }
+        , /* 4 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  2, 14,  0 }
+        , /* 5 */
+          {  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 6 */
+          {  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0 }
+        , /* 7 */
+          {  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 8 */
+          {  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  1 }
+        , /* 9 */
+          {  0,  1,  1,  0,  1,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 10 */
+          {  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 11 */
+          {  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  2,  0,  0,  0 }
+        , /* 12 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1 }
+        , /* 13 */
+          {  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 14 */
+          {  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  6,  0,  1 }
+        , /* 15 */
+          {  1,  1,  1,  1,  1,  0,  0,  1,  1,  0,  1,  1,  1,  1,  0,  0 }
+        , /* 16 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6 }
+        , /* 17 */
+          {  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 18 */
+          {  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0 }
+        , /* 19 */
+          {  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 20 */
+          {  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0 }
+        , /* 21 */
+          {  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  0,  1,  1,  1,  1,  1 }
+        , /* 22 */
+          {  1,  1,  1,  1,  0,  1,  1,  1,  0,  1,  1,  1,  1,  1,  0,  0 }
+        , /* 23 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  0,  0,  0,  0 }
+        , /* 24 */
+          {  6,  6,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 25 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1 }
+        , /* 26 */
+          {  1,  1,  6,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 27 */
+          {  1,  1,  1,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 28 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  5,  1,  0,  5,  5 }
+        , /* 29 */
+          {  5,  1,  1,  1,  1,  1,  1,  1,  1,  5,  5,  5,  5,  1,  5,  5 }
+        , /* 30 */
+          {  0,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 31 */
+          {  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 32 */
+          {  0,  1,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 33 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  5 }
+        , /* 34 */
+          {  5,  1,  1,  1,  1,  0,  0,  5,  5,  0,  0,  5,  5,  1,  0,  0 }
+        , /* 35 */
+          {  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 36 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0 }
+        , /* 37 */
+          {  0,  1,  1,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 38 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  5,  5 }
+        , /* 39 */
+          {  5,  1,  1,  0,  0,  0,  0,  1,  1,  0,  0,  1,  1,  1,  0,  0 }
+        , /* 40 */
+          {  1,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 41 */
+          {  5,  1,  1,  1,  1,  1,  0,  1,  1,  5,  0,  5,  5,  1,  0,  0 }
+        , /* 42 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  1 }
+        , /* 43 */
+          {  0,  0,  0,  0,  0,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 44 */
+          {  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 45 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  5 }
+        , /* 46 */
+          {  1,  5,  5,  0,  0,  0,  5,  5,  5,  0,  5,  5,  5,  1,  0,  0 }
+        , /* 47 */
+          {  1,  5,  5,  5,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 48 */
+          {  1,  5,  5,  5,  5,  0,  1,  1,  1,  0,  1,  1,  1,  1,  0,  0 }
+        , /* 49 */
+          {  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 50 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  5,  1 }
+        , /* 51 */
+          {  5,  5,  1,  5,  5,  0,  1,  5,  5,  0,  5,  5,  1,  1,  0,  0 }
+        , /* 52 */
+          {  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 53 */
+          {  1,  1,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 54 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  1,  5 }
+        , /* 55 */
+          {  5,  1,  1,  1,  1,  0,  5,  5,  5,  0,  5,  5,  5,  1,  6,  0 }
+        , /* 56 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1 }
+        , /* 57 */
+          {  5,  5,  1,  1,  1,  0,  1,  0,  5,  5,  5,  5,  5,  5,  5,  1 }
+        , /* 58 */
+          {  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 59 */
+          {  0,  1,  0,  5,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0 }
+        , /* 60 */
+          {  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  0 }
+        , /* 61 */
+          {  0,  1,  0,  5,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0 }
+        , /* 62 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  0 }
+        , /* 63 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0 }
+        , /* 64 */
+          {  0,  0,  0,  0,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  5,  5 }
+        , /* 65 */
+          {  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  5 }
+        , /* 66 */
+          {  1,  1,  1,  1,  1,  0,  1,  1,  0,  0,  0,  0,  0,  1,  1,  1 }
+        , /* 67 */
+          {  1,  1,  1,  1,  1,  1,  1,  1,  0,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 68 */
+          {  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0 }
+        , /* 69 */
+          {  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 70 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1 }
+        , /* 71 */
+          {  1,  5,  1,  1,  1,  1,  1,  1,  0,  1,  1,  5,  5,  1,  1,  0 }
+        , /* 72 */
+          {  0,  0,  0,  0,  0,  0,  5,  5,  1,  1,  0,  0,  0,  0,  1,  1 }
+        , /* 73 */
+          {  0,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 74 */
+          {  0,  0,  1,  0,  5,  1,  1,  0,  0,  0,  0,  0,  0,  1,  0,  0 }
+        , /* 75 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0 }
+        , /* 76 */
+          { 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23 }
+        , /* 77 */
+          {  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8 }
+        , /* 78 */
+          {  8,  8,  8,  8,  8,  8,  8,  8,  9,  9,  9,  9,  9,  9,  9,  9 }
+        , /* 79 */
+          {  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9 }
+        , /* 80 */
+          {  0,  0,  1,  1,  1,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 81 */
+          {  0,  0,  1,  1,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 82 */
+          {  0,  0,  0,  0,  1,  1,  5,  1,  1,  1,  1,  1,  1,  1,  5,  5 }
+        , /* 83 */
+          {  5,  5,  5,  5,  5,  5,  1,  5,  5,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 84 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  2,  1 }
+        , /* 85 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0 }
+        , /* 86 */
+          {  1,  1,  1,  5,  5,  5,  5,  1,  1,  5,  5,  5,  0,  0,  0,  0 }
+        , /* 87 */
+          {  5,  5,  1,  5,  5,  5,  5,  5,  5,  1,  1,  1,  0,  0,  0,  0 }
+        , /* 88 */
+          {  0,  0,  0,  0,  0,  0,  0,  1,  1,  5,  5,  1,  0,  0,  0,  0 }
+        , /* 89 */
+          {  0,  0,  0,  0,  0,  5,  1,  5,  1,  1,  1,  1,  1,  1,  1,  0 }
+        , /* 90 */
+          {  1,  0,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  5,  5,  5 }
+        , /* 91 */
+          {  5,  5,  5,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  1 }
+        , /* 92 */
+          {  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0 }
+        , /* 93 */
+          {  1,  1,  1,  1,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 94 */
+          {  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  5,  1,  5,  5,  5 }
+        , /* 95 */
+          {  5,  5,  1,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 96 */
+          {  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 97 */
+          {  1,  1,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 98 */
+          {  0,  5,  1,  1,  1,  1,  5,  5,  1,  1,  5,  1,  1,  1,  0,  0 }
+        , /* 99 */
+          {  0,  0,  0,  0,  0,  0,  1,  5,  1,  1,  5,  5,  5,  1,  5,  1 }
+        , /* 100 */
+          {  0,  0,  0,  0,  5,  5,  5,  5,  5,  5,  5,  5,  1,  1,  1,  1 }
+        , /* 101 */
+          {  1,  1,  1,  1,  5,  5,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 102 */
+          {  1,  1,  1,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 103 */
+          {  1,  5,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  1,  0,  0 }
+        , /* 104 */
+          {  0,  0,  0,  0,  1,  0,  0,  5,  1,  1,  0,  0,  0,  0,  0,  0 }
+        , /* 105 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  1, 13,  2,  2 }
+        , /* 106 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  0 }
+        , /* 107 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0 }
+        , /* 108 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0 }
+        , /* 109 */
+          {  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 110 */
+          {  0,  0,  0,  0, 14, 14, 14, 14, 14, 14,  0,  0,  0,  0,  0,  0 }
+        , /* 111 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 14,  0,  0,  0,  0,  0 }
+        , /* 112 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 14,  0,  0,  0,  0 }
+        , /* 113 */
+          {  0,  0,  0,  0,  0,  0,  0,  0, 14, 16, 16,  0,  0,  0,  0,  0 }
+        , /* 114 */
+          {  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 115 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14 }
+        , /* 116 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 14, 14, 14, 14, 14, 14 }
+        , /* 117 */
+          { 14, 14, 14, 14,  0,  0,  0,  0, 14, 14, 14,  0,  0,  0,  0,  0 }
+        , /* 118 */
+          {  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 119 */
+          { 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 120 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 14, 14, 14,  0 }
+        , /* 121 */
+          { 14, 14, 14, 14, 14, 14,  0, 14, 14, 14, 14, 14, 14, 14, 14, 14 }
+        , /* 122 */
+          { 14, 14, 14,  0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14 }
+        , /* 123 */
+          { 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14 }
+        , /* 124 */
+          { 14, 14, 14, 14, 14, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 125 */
+          { 14, 14, 14, 14, 14, 14,  0,  0, 14, 14, 14, 14, 14, 14, 14, 14 }
+        , /* 126 */
+          { 14, 14, 14,  0, 14,  0, 14,  0,  0,  0,  0,  0,  0, 14,  0,  0 }
+        , /* 127 */
+          {  0, 14,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 128 */
+          {  0,  0,  0, 14, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 129 */
+          {  0,  0,  0,  0, 14,  0,  0, 14,  0,  0,  0,  0, 14,  0, 14,  0 }
+        , /* 130 */
+          {  0,  0,  0, 14, 14, 14,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 131 */
+          {  0,  0,  0, 14, 14, 14, 14, 14,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 132 */
+          {  0,  0,  0,  0,  0, 14, 14, 14,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 133 */
+          {  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 134 */
+          { 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14 }
+        , /* 135 */
+          {  0,  0,  0,  0, 14, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 136 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 14,  0,  0,  0 }
+        , /* 137 */
+          { 14,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 138 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1 }
+        , /* 139 */
+          {  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 140 */
+          { 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16 }
+        , /* 141 */
+          { 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17 }
+        , /* 142 */
+          { 30, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 30, 16,  0 }
+        , /* 143 */
+          { 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 16, 16, 16, 16, 16 }
+        , /* 144 */
+          { 16, 16, 16, 16, 16, 16, 16, 30, 16, 30, 16, 16, 16, 16, 16, 16 }
+        , /* 145 */
+          {  1,  1,  1,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0 }
+        , /* 146 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1 }
+        , /* 147 */
+          {  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  1,  0,  0,  0,  0 }
+        , /* 148 */
+          {  0,  0,  0,  5,  5,  1,  1,  5,  0,  0,  0,  0,  1,  0,  0,  0 }
+        , /* 149 */
+          {  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 150 */
+          {  0,  0,  0,  0,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5 }
+        , /* 151 */
+          {  5,  5,  5,  5,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 152 */
+          {  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1 }
+        , /* 153 */
+          {  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0 }
+        , /* 154 */
+          {  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 155 */
+          {  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7 }
+        , /* 156 */
+          {  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0 }
+        , /* 157 */
+          {  0,  0,  0,  1,  5,  5,  1,  1,  1,  1,  5,  5,  1,  1,  5,  5 }
+        , /* 158 */
+          {  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 159 */
+          {  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 160 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  5 }
+        , /* 161 */
+          {  5,  1,  1,  5,  5,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 162 */
+          {  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  1,  5,  0,  0 }
+        , /* 163 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0 }
+        , /* 164 */
+          {  1,  0,  1,  1,  1,  0,  0,  1,  1,  0,  0,  0,  0,  0,  1,  1 }
+        , /* 165 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  1,  1,  5,  5 }
+        , /* 166 */
+          {  0,  0,  0,  0,  0,  5,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 167 */
+          {  0,  0,  0,  5,  5,  1,  5,  5,  1,  5,  5,  0,  5,  1,  0,  0 }
+        , /* 168 */
+          { 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27 }
+        , /* 169 */
+          { 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27 }
+        , /* 170 */
+          { 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27 }
+        , /* 171 */
+          { 27, 27, 27, 27, 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27 }
+        , /* 172 */
+          { 27, 27, 27, 27, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27 }
+        , /* 173 */
+          { 27, 27, 27, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 174 */
+          {  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  9,  9,  9,  9,  9 }
+        , /* 175 */
+          {  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  0,  0,  0,  0 }
+        , /* 176 */
+          { 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,  0,  0,  0,  0,  0 }
+        , /* 177 */
+          { 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 178 */
+          { 16, 16, 16, 16, 16, 16, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 179 */
+          {  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  0,  0,  0,  0 }
+        , /* 180 */
+          {  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0 }
+        , /* 181 */
+          {  0,  1,  1,  1,  0,  1,  1,  0,  0,  0,  0,  0,  1,  1,  1,  1 }
+        , /* 182 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  0,  0,  0,  0,  1 }
+        , /* 183 */
+          {  0,  0,  0,  0,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 184 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0 }
+        , /* 185 */
+          {  0,  0,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 186 */
+          {  5,  1,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 187 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 188 */
+          {  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 189 */
+          {  1,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1 }
+        , /* 190 */
+          {  5,  5,  5,  1,  1,  1,  1,  5,  5,  1,  1,  0,  0,  6,  0,  0 }
+        , /* 191 */
+          {  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0 }
+        , /* 192 */
+          {  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 193 */
+          {  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  5,  1,  1,  1 }
+        , /* 194 */
+          {  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 195 */
+          {  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 196 */
+          {  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 197 */
+          {  0,  0,  0,  5,  5,  5,  1,  1,  1,  1,  1,  1,  1,  1,  1,  5 }
+        , /* 198 */
+          {  5,  0,  6,  6,  0,  0,  0,  0,  0,  1,  1,  1,  1,  0,  5,  1 }
+        , /* 199 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  5,  1 }
+        , /* 200 */
+          {  1,  1,  5,  5,  1,  5,  1,  1,  0,  0,  0,  0,  0,  0,  1,  0 }
+        , /* 201 */
+          {  5,  5,  5,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0 }
+        , /* 202 */
+          {  1,  5,  5,  5,  5,  0,  0,  5,  5,  0,  0,  5,  5,  5,  0,  0 }
+        , /* 203 */
+          {  0,  0,  5,  5,  0,  0,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0 }
+        , /* 204 */
+          {  0,  0,  0,  0,  0,  5,  5,  5,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 205 */
+          {  5,  5,  1,  1,  1,  5,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 206 */
+          {  1,  5,  5,  1,  1,  1,  1,  1,  1,  5,  1,  5,  5,  1,  5,  1 }
+        , /* 207 */
+          {  1,  5,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 208 */
+          {  5,  5,  1,  1,  1,  1,  0,  0,  5,  5,  5,  5,  1,  1,  5,  1 }
+        , /* 209 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0 }
+        , /* 210 */
+          {  5,  5,  5,  1,  1,  1,  1,  1,  1,  1,  1,  5,  5,  1,  5,  1 }
+        , /* 211 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  5,  1,  5,  5 }
+        , /* 212 */
+          {  1,  1,  1,  1,  1,  1,  5,  1,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 213 */
+          {  0,  0,  1,  1,  1,  1,  5,  1,  1,  1,  1,  1,  0,  0,  0,  0 }
+        , /* 214 */
+          {  1,  1,  1,  1,  1,  1,  1,  1,  5,  1,  1,  0,  0,  0,  0,  0 }
+        , /* 215 */
+          {  1,  5,  5,  5,  5,  5,  0,  5,  5,  0,  0,  1,  1,  5,  1,  6 }
+        , /* 216 */
+          {  5,  6,  5,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 217 */
+          {  0,  5,  5,  5,  1,  1,  1,  1,  0,  0,  1,  1,  5,  5,  5,  5 }
+        , /* 218 */
+          {  1,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 219 */
+          {  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0 }
+        , /* 220 */
+          {  0,  0,  0,  1,  1,  1,  1,  1,  1,  5,  6,  1,  1,  1,  1,  0 }
+        , /* 221 */
+          {  0,  1,  1,  1,  1,  1,  1,  5,  5,  1,  1,  1,  0,  0,  0,  0 }
+        , /* 222 */
+          {  0,  0,  0,  0,  6,  6,  6,  6,  6,  6,  1,  1,  1,  1,  1,  1 }
+        , /* 223 */
+          {  1,  1,  1,  1,  1,  1,  1,  5,  1,  1,  0,  0,  0,  0,  0,  0 }
+        , /* 224 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5 }
+        , /* 225 */
+          {  1,  1,  1,  1,  1,  1,  1,  0,  1,  1,  1,  1,  1,  1,  5,  1 }
+        , /* 226 */
+          {  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 227 */
+          {  1,  1,  1,  1,  1,  1,  1,  1,  0,  5,  1,  1,  1,  1,  1,  1 }
+        , /* 228 */
+          {  1,  5,  1,  1,  5,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 229 */
+          {  0,  1,  1,  1,  1,  1,  1,  0,  0,  0,  1,  0,  1,  1,  0,  1 }
+        , /* 230 */
+          {  1,  1,  1,  1,  1,  1,  6,  1,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 231 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  5,  5,  5,  0 }
+        , /* 232 */
+          {  1,  1,  0,  5,  5,  1,  5,  1,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 233 */
+          {  0,  0,  0,  1,  1,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 234 */
+          {  1,  1,  6,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 235 */
+          {  0,  0,  0,  0,  5,  5,  1,  1,  1,  1,  1,  0,  0,  0,  5,  5 }
+        , /* 236 */
+          {  1,  5,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 237 */
+          {  1,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 238 */
+          {  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 239 */
+          {  0,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5 }
+        , /* 240 */
+          {  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5 }
+        , /* 241 */
+          {  5,  5,  5,  5,  5,  5,  5,  5,  0,  0,  0,  0,  0,  0,  0,  1 }
+        , /* 242 */
+          {  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 243 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0 }
+        , /* 244 */
+          {  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 245 */
+          {  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0 }
+        , /* 246 */
+          {  0,  0,  0,  0,  0,  1,  5,  1,  1,  1,  0,  0,  0,  5,  1,  1 }
+        , /* 247 */
+          {  1,  1,  1,  2,  2,  2,  2,  2,  2,  2,  2,  1,  1,  1,  1,  1 }
+        , /* 248 */
+          {  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0 }
+        , /* 249 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  0,  0 }
+        , /* 250 */
+          {  0,  0,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 }
+        , /* 251 */
+          {  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  1,  1,  1,  1,  1 }
+        , /* 252 */
+          {  1,  1,  1,  1,  1,  1,  1,  0,  1,  1,  1,  1,  1,  1,  1,  1 }
+        , /* 253 */
+          {  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1 }
+        , /* 254 */
+          {  1,  1,  0,  1,  1,  0,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0 }
+        , /* 255 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1 }
+        , /* 256 */
+          {  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0 }
+        , /* 257 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 14, 14 }
+        , /* 258 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 14, 14, 14 }
+        , /* 259 */
+          { 14, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 14 }
+        , /* 260 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0 }
+        , /* 261 */
+          {  0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  0,  0,  0,  0,  0 }
+        , /* 262 */
+          { 14, 14, 14, 14, 14, 14, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12 }
+        , /* 263 */
+          { 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12 }
+        , /* 264 */
+          {  0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14 }
+        , /* 265 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0 }
+        , /* 266 */
+          {  0,  0, 14, 14, 14, 14, 14, 14, 14, 14, 14,  0, 14, 14, 14, 14 }
+        , /* 267 */
+          { 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 }
+        , /* 268 */
+          { 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 17, 17, 17, 17, 17 }
+        , /* 269 */
+          { 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 16, 16 }
+        , /* 270 */
+          { 16, 16, 16, 16, 16, 16, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 }
+        , /* 271 */
+          {  0,  0,  0,  0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14 }
+        , /* 272 */
+          {  0,  0,  0,  0,  0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14 }
+        , /* 273 */
+          {  0,  0,  0,  0,  0,  0,  0,  0, 14, 14, 14, 14, 14, 14, 14, 14 }
+        , /* 274 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 14, 14, 14, 14, 14 }
+        , /* 275 */
+          {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 14 }
+        , /* 276 */
+          { 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 30, 30, 30, 30 }
+        , /* 277 */
+          { 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 16, 30, 30, 30, 30 }
+        , /* 278 */
+          { 30, 30, 30, 30, 30, 30, 16, 30, 30, 30, 30, 30, 30, 30, 30, 30 }
+        , /* 279 */
+          { 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,  0,  0 }
+        , /* 280 */
+          { 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,  0 }
+        };
+
+    if (ch >= 0x110000) {
+        return gcb_prop::other;
+    }
+    const auto block2 = stage1[ch >> 9];
+    const auto block3 = stage2[block2][(ch >> 4) & 0x1F];
+    return stage3[block3][ch & 0xF];
+}
+
+#else
+
+STRF_HD unsigned ch32_width_and_gcb_prop(char32_t ch) noexcept;
+
+#endif // ! defined(STRF_OMIT_IMPL)
+
+} // namespace detail
+} // namespace strf
+
+#endif  // STRF_DETAIL_CH32_WIDTH_AND_GCB_PROP_HPP
@@ -7,6 +7,13 @@
 //  http://www.boost.org/LICENSE_1_0.txt)
 
 #include <strf/detail/facets/charset.hpp>
+#include <strf/detail/ch32_width_and_gcb_prop.hpp>
+#include <strf/detail/simd.hpp>
+
+// Number of code points that the width calculators decode at a time
+#if ! defined(STRF_WIDTH_CALC_BUFFER_SIZE)
+#  define STRF_WIDTH_CALC_BUFFER_SIZE 64
+#endif
 
 namespace strf {
 
@@ -177,7 +184,7 @@ public:
 private:
 
     bool whole_string_covered_ = true;
-    constexpr static std::size_t buff_size_ = 16;
+    constexpr static std::size_t buff_size_ = STRF_WIDTH_CALC_BUFFER_SIZE;
     char32_t buff_[buff_size_];
     const strf::width_t limit_;
     strf::width_t width_ = 0;
@@ -206,6 +213,120 @@ void STRF_HD width_accumulator<WFunc>::recycle()
     }
 }
 
+// For the static UTF charsets, the width calculators decode the
+// string by themselves, instead of using a strf::destination<char32_t>
+
+template <typename Charset>
+struct is_static_utf_charset: std::false_type {};
+
+template <typename CharT>
+struct is_static_utf_charset<strf::static_charset<CharT, strf::csid_utf8>>
+    : std::true_type {};
+
+template <typename CharT>
+struct is_static_utf_charset<strf::static_charset<CharT, strf::csid_utf16>>
+    : std::true_type {};
+
+template <typename CharT>
+struct is_static_utf_charset<strf::static_charset<CharT, strf::csid_utf32>>
+    : std::true_type {};
+
+template <typename CharT>
+inline STRF_HD const CharT* decode_chunk
+    ( strf::static_charset<CharT, strf::csid_utf8>
+    , const CharT* src
+    , const CharT* src_end
+    , char32_t*& dest
+    , char32_t* dest_end
+    , strf::surrogate_policy surr_poli ) noexcept
+{
+    return strf::detail::utf8_decode_chunk(src, src_end, dest, dest_end, surr_poli);
+}
+
+template <typename CharT>
+inline STRF_HD const CharT* decode_chunk
+    ( strf::static_charset<CharT, strf::csid_utf16>
+    , const CharT* src
+    , const CharT* src_end
+    , char32_t*& dest
+    , char32_t* dest_end
+    , strf::surrogate_policy surr_poli ) noexcept
+{
+    return strf::detail::utf16_decode_chunk(src, src_end, dest, dest_end, surr_poli);
+}
+
+template <typename CharT>
+inline STRF_HD const CharT* decode_chunk
+    ( strf::static_charset<CharT, strf::csid_utf32>
+    , const CharT* src
+    , const CharT* src_end
+    , char32_t*& dest
+    , char32_t* dest_end
+    , strf::surrogate_policy surr_poli ) noexcept
+{
+    return strf::detail::utf32_decode_chunk(src, src_end, dest, dest_end, surr_poli);
+}
+
+template <typename Charset, typename WFunc>
+STRF_HD strf::width_and_pos width_by_func_and_pos
+    ( std::true_type // is_static_utf_charset
+    , Charset charset
+    , WFunc func
+    , strf::width_t limit
+    , const typename Charset::code_unit* str
+    , std::size_t str_len
+    , strf::surrogate_policy surr_poli
+    , bool return_pos )
+{
+    constexpr std::size_t buff_size = STRF_WIDTH_CALC_BUFFER_SIZE;
+    char32_t buff[buff_size];
+    strf::width_t width = 0;
+    auto src = str;
+    const auto src_end = str + str_len;
+    while (src != src_end) {
+        char32_t* buff_end = buff;
+        const auto src_next = strf::detail::decode_chunk
+            (charset, src, src_end, buff_end, buff + buff_size, surr_poli);
+        for (auto it = buff; it != buff_end; ++it) {
+            auto w = width + func(*it);
+            if (w > limit) {
+                if (! return_pos) {
+                    return {width, 0};
+                }
+                auto res = charset.codepoints_robust_count
+                    (src, src_next - src, it - buff, surr_poli);
+                return {width, (src - str) + res.pos};
+            }
+            width = w;
+        }
+        src = src_next;
+    }
+    return {width, str_len};
+}
+
+template <typename Charset, typename WFunc>
+STRF_HD strf::width_and_pos width_by_func_and_pos
+    ( std::false_type // is_static_utf_charset
+    , Charset charset
+    , WFunc func
+    , strf::width_t limit
+    , const typename Charset::code_unit* str
+    , std::size_t str_len
+    , strf::surrogate_policy surr_poli
+    , bool return_pos )
+{
+    strf::detail::width_accumulator<WFunc> acc(limit, func);
+    strf::invalid_seq_notifier inv_seq_notifier{};
+    charset.to_u32().transcode(acc, str, str_len, inv_seq_notifier, surr_poli);
+    auto res = acc.get_result();
+    if (res.whole_string_covered || ! return_pos) {
+        return {res.width, str_len};
+    }
+    auto res2 = charset.codepoints_robust_count
+        (str, str_len, res.codepoints_count, surr_poli);
+    return {res.width, res2.pos};
+}
+
 } // namespace detail
 
 
@@ -238,10 +359,10 @@ public:
         , std::size_t str_len
         , strf::surrogate_policy surr_poli ) const
     {
-        strf::detail::width_accumulator<CharWidthFunc> acc(limit, func_);
-        strf::invalid_seq_notifier inv_seq_notifier{};
-        charset.to_u32().transcode(acc, str, str_len, inv_seq_notifier, surr_poli);
-        return acc.get_result().width;
+        return strf::detail::width_by_func_and_pos
+            ( strf::detail::is_static_utf_charset<Charset>{}, charset, func_
+            , limit, str, str_len, surr_poli, false )
+            .width;
     }
 
     template <typename Charset>
@@ -252,16 +373,9 @@ public:
         , std::size_t str_len
         , strf::surrogate_policy surr_poli ) const
     {
-        strf::detail::width_accumulator<CharWidthFunc> acc(limit, func_);
-        strf::invalid_seq_notifier inv_seq_notifier{};
-        charset.to_u32().transcode(acc, str, str_len, inv_seq_notifier, surr_poli);
-        auto res = acc.get_result();
-        if (res.whole_string_covered) {
-            return {res.width, str_len};
-        }
-        auto res2 = charset.codepoints_robust_count
-            (str, str_len, res.codepoints_count, surr_poli);
-        return {res.width, res2.pos};
+        return strf::detail::width_by_func_and_pos
+            ( strf::detail::is_static_utf_charset<Charset>{}, charset, func_
+            , limit, str, str_len, surr_poli, true );
     }
 
 private:
@@ -370,7 +484,29 @@ STRF_FUNC_IMPL STRF_HD std_width_calc_func_return std_width_calc_func
         goto handle_control;
     }
 
-#include <strf/detail/ch32_width_and_gcb_prop>
+    {
+        const unsigned prop = strf::detail::ch32_width_and_gcb_prop(ch);
+        if (prop & gcb_prop::wide) {
+            ch_width = 2_w;
+        }
+        switch (prop & gcb_prop::category_mask) {
+            case gcb_prop::extend:             goto handle_extend;
+            case gcb_prop::control:            goto handle_control;
+            case gcb_prop::cr:                 goto handle_cr;
+            case gcb_prop::lf:                 goto handle_lf;
+            case gcb_prop::spacing_mark:       goto handle_spacing_mark;
+            case gcb_prop::prepend:            goto handle_prepend;
+            case gcb_prop::hangul_l:           goto handle_hangul_l;
+            case gcb_prop::hangul_v:           goto handle_hangul_v;
+            case gcb_prop::hangul_t:           goto handle_hangul_t;
+            case gcb_prop::hangul_lv:          goto handle_hangul_lv;
+            case gcb_prop::hangul_lvt:         goto handle_hangul_lvt;
+            case gcb_prop::regional_indicator: goto handle_regional_indicator;
+            case gcb_prop::zwj:                goto handle_zwj;
+            case gcb_prop::extended_picto:     goto handle_extended_picto;
+            default:                           goto handle_other;
+        }
+    }
 
     handle_zwj:
     if (state == after_xpic) {
@@ -380,7 +516,6 @@ STRF_FUNC_IMPL STRF_HD std_width_calc_func_return std_width_calc_func
     goto handle_spacing_mark; // because the code is the same
 
     handle_extend:
-    handle_extend_and_control:
     if (state == after_xpic) {
         goto next_codepoint;
     }
@@ -463,34 +598,29 @@ STRF_FUNC_IMPL STRF_HD std_width_calc_func_return std_width_calc_func
         state = after_hangul_t;
         goto next_codepoint;
     }
-    handle_hangul_lv_or_lvt:
-    if ( ch <= 0xD788 // && 0xAC00 <= ch
-         && 0 == (ch & 3)
-         && 0 == ((ch - 0xAC00) >> 2) % 7)
-    {   // LV
-        if (state == after_hangul_l) {
-            state = after_hangul_lv;
-            goto next_codepoint;
-        }
-        if (state != after_prepend) {
-            state = after_hangul_lv;
-            goto decrement_width;
-        }
+    handle_hangul_lv:
+    if (state == after_hangul_l) {
         state = after_hangul_lv;
         goto next_codepoint;
+    }
+    if (state != after_prepend) {
+        state = after_hangul_lv;
+        goto decrement_width;
+    }
+    state = after_hangul_lv;
+    goto next_codepoint;
 
-    } else { // LVT
-        if (state == after_hangul_l) {
-            state = after_hangul_lvt;
-            goto next_codepoint;
-        }
-        if (state != after_prepend) {
-            state = after_hangul_lvt;
-            goto decrement_width;
-        }
+    handle_hangul_lvt:
+    if (state == after_hangul_l) {
         state = after_hangul_lvt;
         goto next_codepoint;
     }
+    if (state != after_prepend) {
+        state = after_hangul_lvt;
+        goto decrement_width;
+    }
+    state = after_hangul_lvt;
+    goto next_codepoint;
 
     handle_cr:
     state = after_cr;
@@ -554,7 +684,7 @@ public:
 private:
     strf::width_t width_;
     unsigned state_ = 0;
-    static constexpr std::size_t buff_size_ = 16;
+    static constexpr std::size_t buff_size_ = STRF_WIDTH_CALC_BUFFER_SIZE;
     char32_t buff_[buff_size_];
 };
 
@@ -601,10 +731,139 @@ private:
     strf::width_t width_;
     unsigned state_ = 0;
     std::size_t codepoints_count_ = 0;
-    static constexpr std::size_t buff_size_ = 16;
+    static constexpr std::size_t buff_size_ = STRF_WIDTH_CALC_BUFFER_SIZE;
     char32_t buff_[buff_size_];
 };
 
+constexpr STRF_HD bool is_ascii_compatible(strf::charset_id id) noexcept
+{
+    return id == strf::csid_ascii
+        || id == strf::csid_utf8
+        || id == strf::csid_utf16
+        || id == strf::csid_utf32
+        || id == strf::csid_iso_8859_1
+        || id == strf::csid_iso_8859_2
+        || id == strf::csid_iso_8859_3
+        || id == strf::csid_iso_8859_4
+        || id == strf::csid_iso_8859_5
+        || id == strf::csid_iso_8859_6
+        || id == strf::csid_iso_8859_7
+        || id == strf::csid_iso_8859_8
+        || id == strf::csid_iso_8859_9
+        || id == strf::csid_iso_8859_10
+        || id == strf::csid_iso_8859_11
+        || id == strf::csid_iso_8859_13
+        || id == strf::csid_iso_8859_14
+        || id == strf::csid_iso_8859_15
+        || id == strf::csid_iso_8859_16
+        || id == strf::csid_windows_1250
+        || id == strf::csid_windows_1251
+        || id == strf::csid_windows_1252
+        || id == strf::csid_windows_1253
+        || id == strf::csid_windows_1254
+        || id == strf::csid_windows_1255
+        || id == strf::csid_windows_1256
+        || id == strf::csid_windows_1257
+        || id == strf::csid_windows_1258;
+}
+
+// Returns the number of code units at the beginning of `str`,
+// up to `len`, whose values are from 0x20 to 0x7E.
+template <typename CharT>
+STRF_HD std::size_t printable_ascii_prefix(const CharT* str, std::size_t len) noexcept
+{
+    using uint_t = typename std::conditional
+        < sizeof(CharT) == 1
+        , std::uint8_t
+        , typename std::conditional<sizeof(CharT) == 2, std::uint16_t, std::uint32_t>::type >
+        ::type;
+
+    const auto* ustr = reinterpret_cast<const uint_t*>(str);
+#if defined(STRF_HAS_SIMD)
+    if (len >= strf::detail::simd::min_simd_input_size) {
+        return strf::detail::simd::printable_ascii_prefix(ustr, len);
+    }
+#endif
+    std::size_t i = 0;
+    for (; i < len && static_cast<uint_t>(ustr[i] - 0x20) < 0x5F; ++i) {
+    }
+    return i;
+}
+
+inline STRF_HD bool is_less_than(std::size_t len, strf::width_t width) noexcept
+{
+    return len <= 0xFFFF && strf::width_t(static_cast<std::uint16_t>(len)) < width;
+}
+
+template <typename Charset>
+STRF_HD strf::width_and_pos std_width_and_pos
+    ( std::true_type // is_static_utf_charset
+    , Charset charset
+    , strf::width_t limit
+    , const typename Charset::code_unit* str
+    , std::size_t str_len
+    , strf::surrogate_policy surr_poli
+    , bool return_pos )
+{
+    if (limit == 0) {
+        return {0, 0};
+    }
+    constexpr std::size_t buff_size = STRF_WIDTH_CALC_BUFFER_SIZE;
+    char32_t buff[buff_size];
+    strf::width_t width = limit;
+    unsigned state = 0;
+    auto src = str;
+    const auto src_end = str + str_len;
+    while (src != src_end) {
+        char32_t* buff_end = buff;
+        const auto src_next = strf::detail::decode_chunk
+            (charset, src, src_end, buff_end, buff + buff_size, surr_poli);
+        auto res = strf::detail::std_width_calc_func(buff, buff_end, width, state, return_pos);
+        if (res.ptr != buff_end) {
+            // the limit has been reached
+            if (! return_pos) {
+                return {limit, 0};
+            }
+            auto res2 = charset.codepoints_robust_count
+                (src, src_next - src, res.ptr - buff, surr_poli);
+            return {limit - res.width, (src - str) + res2.pos};
+        }
+        width = res.width;
+        state = res.state;
+        src = src_next;
+    }
+    return {limit - width, str_len};
+}
+
+template <typename Charset>
+STRF_HD strf::width_and_pos std_width_and_pos
+    ( std::false_type // is_static_utf_charset
+    , Charset charset
+    , strf::width_t limit
+    , const typename Charset::code_unit* str
+    , std::size_t str_len
+    , strf::surrogate_policy surr_poli
+    , bool return_pos )
+{
+    strf::invalid_seq_notifier inv_seq_notifier{};
+    if (! return_pos) {
+        strf::detail::std_width_decrementer decr{limit};
+        charset.to_u32().transcode(decr, str, str_len, inv_seq_notifier, surr_poli);
+        return {limit - decr.get_remaining_width(), str_len};
+    }
+    strf::detail::std_width_decrementer_with_pos decr{limit};
+    charset.to_u32().transcode(decr, str, str_len, inv_seq_notifier, surr_poli);
+    auto res = decr.get_remaining_width_and_codepoints_count();
+
+    strf::width_t width = limit - res.remaining_width;
+    if (res.whole_string_covered) {
+        return {width, str_len};
+    }
+    auto res2 = charset.codepoints_robust_count
+        (str, str_len, res.codepoints_count, surr_poli);
+    return {width, res2.pos};
+}
+
 } // namespace detail
 
 class std_width_calc_t
@@ -681,10 +940,27 @@ public:
         , std::size_t str_len
         , strf::surrogate_policy surr_poli )
     {
-        strf::detail::std_width_decrementer decr{limit};
-        strf::invalid_seq_notifier inv_seq_notifier{};
-        charset.to_u32().transcode(decr, str, str_len, inv_seq_notifier, surr_poli);
-        return (limit - decr.get_remaining_width());
+        std::size_t skipped = 0;
+        if (strf::detail::is_ascii_compatible(charset.id())) {
+            // Each printable ASCII character is a grapheme cluster of width 1,
+            // except the last one, which may be followed by combining marks.
+            const auto max_len = strf::detail::min<std::size_t>(str_len, limit.floor() + 1u);
+            const auto ascii_len = strf::detail::printable_ascii_prefix(str, max_len);
+            if (ascii_len == str_len) {
+                return strf::detail::is_less_than(str_len, limit)
+                    ? strf::width_t(static_cast<std::uint16_t>(str_len))
+                    : limit;
+            }
+            skipped = ascii_len - (ascii_len != 0);
+            if (! strf::detail::is_less_than(skipped, limit)) {
+                return limit;
+            }
+        }
+        const auto skipped_width = static_cast<std::uint16_t>(skipped);
+        const auto res = strf::detail::std_width_and_pos
+            ( strf::detail::is_static_utf_charset<Charset>{}, charset
+            , limit - skipped_width, str + skipped, str_len - skipped, surr_poli, false );
+        return res.width + skipped_width;
     }
 
     template <typename Charset>
@@ -695,18 +971,25 @@ public:
         , std::size_t str_len
         , strf::surrogate_policy surr_poli )
     {
-        strf::detail::std_width_decrementer_with_pos decr{limit};
-        strf::invalid_seq_notifier inv_seq_notifier{};
-        charset.to_u32().transcode(decr, str, str_len, inv_seq_notifier, surr_poli);
-        auto res = decr.get_remaining_width_and_codepoints_count();
-
-        strf::width_t width = limit - res.remaining_width;
-        if (res.whole_string_covered) {
-            return {width, str_len};
+        std::size_t skipped = 0;
+        if (strf::detail::is_ascii_compatible(charset.id())) {
+            // Each printable ASCII character is a grapheme cluster of width 1,
+            // except the last one, which may be followed by combining marks.
+            const auto max_len = strf::detail::min<std::size_t>(str_len, limit.floor() + 1u);
+            const auto ascii_len = strf::detail::printable_ascii_prefix(str, max_len);
+            if (ascii_len == str_len && strf::detail::is_less_than(str_len, limit)) {
+                return {static_cast<std::uint16_t>(str_len), str_len};
+            }
+            skipped = ascii_len - (ascii_len != 0);
+            if (! strf::detail::is_less_than(skipped, limit)) {
+                return {limit, limit.floor()};
+            }
         }
-        auto res2 = charset.codepoints_robust_count
-            (str, str_len, res.codepoints_count, surr_poli);
-        return {width, res2.pos};
+        const auto skipped_width = static_cast<std::uint16_t>(skipped);
+        const auto res = strf::detail::std_width_and_pos
+            ( strf::detail::is_static_utf_charset<Charset>{}, charset
+            , limit - skipped_width, str + skipped, str_len - skipped, surr_poli, true );
+        return {res.width + skipped_width, skipped + res.pos};
     }
 };
 
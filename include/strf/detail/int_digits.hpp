@@ -490,11 +490,63 @@ struct digits_counter<10, 2>
     }
 };
 
+#if defined(STRF_HAS_COUNTL_ZERO) && defined(STRF_HAS_IS_CONSTANT_EVALUATED) \
+    && ! defined(__CUDA_ARCH__)
+
+// The entry i is used for the values in [2^i, 2^(i+1)). Its higher 32 bits
+// hold the number of digits of 2^i. When 10^n is in that range, where
+// n is this number of digits, the lower bits hold 2^32 - 10^n, so that the
+// addition carries into the higher bits for values not less than 10^n.
+// ( Daniel Lemire's technique )
+inline STRF_HD const unsigned long long* digits_count_table_32() noexcept
+{
+    static const unsigned long long table[] =
+        { 4294967296ull,  4294967296ull,  4294967296ull,  8589934582ull
+        , 8589934592ull,  8589934592ull,  12884901788ull, 12884901888ull
+        , 12884901888ull, 17179868184ull, 17179869184ull, 17179869184ull
+        , 17179869184ull, 21474826480ull, 21474836480ull, 21474836480ull
+        , 25769703776ull, 25769803776ull, 25769803776ull, 30063771072ull
+        , 30064771072ull, 30064771072ull, 30064771072ull, 34349738368ull
+        , 34359738368ull, 34359738368ull, 38554705664ull, 38654705664ull
+        , 38654705664ull, 41949672960ull, 42949672960ull, 42949672960ull };
+    return table;
+}
+
+inline STRF_HD unsigned count_decimal_digits_fast(std::uint32_t value) noexcept
+{
+    const unsigned long long x = value;
+    const int log2 = 63 - strf::detail::countl_zero_ll(x | 1);
+    return static_cast<unsigned>((x + strf::detail::digits_count_table_32()[log2]) >> 32);
+}
+
+// bits * 1233 >> 12 is floor(bits * log10(2)) for bits <= 64,
+// which is either the number of digits or one less than it.
+inline STRF_HD unsigned count_decimal_digits_fast(std::uint64_t value) noexcept
+{
+    const unsigned long long x = value | 1;
+    const unsigned bits = 64 - strf::detail::countl_zero_ll(x);
+    const unsigned t = (bits * 1233) >> 12;
+    return t + (x >= strf::detail::pow10(t));
+}
+
+#endif
+
+// The fast versions above use a lookup table and countl_zero, which
+// are not usable in constant expressions. Hence the cascades below
+// are still used during constant evaluation.
+
 template<>
 struct digits_counter<10, 4>
 {
     STRF_CONSTEXPR_IN_CXX14 static STRF_HD unsigned count_digits_unsigned(uint_fast32_t value) noexcept
     {
+#if defined(STRF_HAS_COUNTL_ZERO) && defined(STRF_HAS_IS_CONSTANT_EVALUATED) \
+    && ! defined(__CUDA_ARCH__)
+        if ( ! strf::detail::is_constant_evaluated()) {
+            STRF_ASSERT(value <= 0xFFFFFFFFul);
+            return count_decimal_digits_fast(static_cast<std::uint32_t>(value));
+        }
+#endif
         if (value <= 9999ul) {
             if (value <= 99ul) {
                 return value <= 9ul ? 1 : 2;
@@ -524,6 +576,12 @@ struct digits_counter<10, 8>
     STRF_CONSTEXPR_IN_CXX14 static STRF_HD unsigned count_digits_unsigned
         ( uint_fast64_t value ) noexcept
     {
+#if defined(STRF_HAS_COUNTL_ZERO) && defined(STRF_HAS_IS_CONSTANT_EVALUATED) \
+    && ! defined(__CUDA_ARCH__)
+        if ( ! strf::detail::is_constant_evaluated()) {
+            return count_decimal_digits_fast(static_cast<std::uint64_t>(value));
+        }
+#endif
         if (value <= 99999999ull) {
             if (value <= 9999) {
                 if (value <= 99ull) {
@@ -565,6 +623,73 @@ struct digits_counter<10, 8>
     }
 };
 
+#if defined(STRF_HAS_INT128)
+
+// 10^n for n <= 38
+inline STRF_HD strf::detail::uint128_t pow10_128(unsigned n) noexcept
+{
+    STRF_ASSERT(n <= 38);
+    return n <= 19
+        ? static_cast<strf::detail::uint128_t>(strf::detail::pow10(n))
+        : static_cast<strf::detail::uint128_t>(strf::detail::pow10(19)) * strf::detail::pow10(n - 19);
+}
+
+// The 128-bit counters rely on the 64-bit ones for each half of the value
+
+template<>
+struct digits_counter<10, 16>
+{
+    static STRF_HD unsigned count_digits(strf::detail::uint128_t value) noexcept
+    {
+        const auto high = static_cast<unsigned long long>(value >> 64);
+        if (high == 0) {
+            return digits_counter<10, 8>::count_digits(static_cast<unsigned long long>(value));
+        }
+        // the same technique as in digits_counter<10, 8>
+        const unsigned bits = 64 + digits_counter<2, 8>::count_digits(high);
+        const unsigned t = (bits * 1233) >> 12;
+        return t + (value >= strf::detail::pow10_128(t));
+    }
+};
+
+template<>
+struct digits_counter<16, 16>
+{
+    static STRF_HD unsigned count_digits(strf::detail::uint128_t value) noexcept
+    {
+        const auto high = static_cast<unsigned long long>(value >> 64);
+        return high == 0
+            ? digits_counter<16, 8>::count_digits(static_cast<unsigned long long>(value))
+            : 16 + digits_counter<16, 8>::count_digits(high);
+    }
+};
+
+template<>
+struct digits_counter<8, 16>
+{
+    static STRF_HD unsigned count_digits(strf::detail::uint128_t value) noexcept
+    {
+        const auto high = static_cast<unsigned long long>(value >> 64);
+        return high == 0
+            ? digits_counter<8, 8>::count_digits(static_cast<unsigned long long>(value))
+            : (66 + digits_counter<2, 8>::count_digits(high)) / 3;
+    }
+};
+
+template<>
+struct digits_counter<2, 16>
+{
+    static STRF_HD unsigned count_digits(strf::detail::uint128_t value) noexcept
+    {
+        const auto high = static_cast<unsigned long long>(value >> 64);
+        return high == 0
+            ? digits_counter<2, 8>::count_digits(static_cast<unsigned long long>(value))
+            : 64 + digits_counter<2, 8>::count_digits(high);
+    }
+};
+
+#endif // defined(STRF_HAS_INT128)
+
 template <unsigned Base, typename intT>
 STRF_CONSTEXPR_IN_CXX14 STRF_HD unsigned count_digits(intT value) noexcept
 {
@@ -624,6 +749,115 @@ public:
             return it - 2;
         }
     }
+
+#if defined(STRF_HAS_INT128)
+
+    // Splits the value in chunks of 19 digits, so that each one is
+    // written with 64-bit arithmetic
+    template <typename CharT>
+    static STRF_HD CharT* write_txtdigits_backwards
+        ( strf::detail::uint128_t uvalue
+        , CharT* it
+        , strf::lettercase lc = strf::lowercase ) noexcept
+    {
+        constexpr unsigned long long e19 = 10000000000000000000ull;
+        while (uvalue >> 64) {
+            const strf::detail::uint128_t quotient = uvalue / e19;
+            const auto chunk = static_cast<unsigned long long>(uvalue - quotient * e19);
+            CharT* const chunk_begin = it - 19;
+            it = write_txtdigits_backwards(chunk, it, lc);
+            while (it != chunk_begin) {
+                *--it = static_cast<CharT>('0');
+            }
+            uvalue = quotient;
+        }
+        return write_txtdigits_backwards(static_cast<unsigned long long>(uvalue), it, lc);
+    }
+
+    // Writes the digits in a temporary array, and then copies
+    // them inserting the separators
+    template <typename CharT>
+    static STRF_HD void write_txtdigits_backwards_little_sep
+        ( CharT* it
+        , strf::detail::uint128_t uvalue
+        , strf::digits_grouping_iterator git
+        , CharT sep
+        , strf::lettercase lc ) noexcept
+    {
+        STRF_ASSERT(uvalue != 0);
+        STRF_ASSERT(! git.ended());
+
+        char digits[39];
+        const char* const digits_begin = write_txtdigits_backwards(uvalue, digits + 39, lc);
+        const char* p = digits + 39;
+        auto digits_before_sep = git.current();
+        while (1) {
+            *--it = static_cast<CharT>(*--p);
+            if (p == digits_begin) {
+                return;
+            }
+            if (digits_before_sep != 1) {
+                -- digits_before_sep;
+            } else {
+                *--it = sep;
+                if (git.is_final()) {
+                    break;
+                }
+                if ( ! git.is_last()) {
+                    git.advance();
+                }
+                digits_before_sep = git.current();
+            }
+        }
+        while (p != digits_begin) {
+            *--it = static_cast<CharT>(*--p);
+        }
+    }
+
+#endif // defined(STRF_HAS_INT128)
+
+    // For groupings where all groups have the same size, like the
+    // usual thousands grouping. Each group is obtained with a single
+    // division, instead of tracking the position of each digit.
+    template <typename UIntT, typename CharT>
+    static STRF_HD void write_txtdigits_backwards_uniform_sep
+        ( CharT* it
+        , UIntT uvalue
+        , unsigned grp
+        , CharT sep ) noexcept
+    {
+        static_assert(std::is_unsigned<UIntT>::value, "");
+        STRF_ASSERT(grp != 0);
+
+        if (grp == 3) {
+            const char* arr = strf::detail::chars_00_to_99();
+            while (uvalue > 999) {
+                const auto group = static_cast<unsigned>(uvalue % 1000);
+                uvalue /= 1000;
+                const unsigned hundreds = (group * 41) >> 12; // group / 100
+                const unsigned index = (group - hundreds * 100) << 1;
+                it[-1] = static_cast<CharT>(arr[index + 1]);
+                it[-2] = static_cast<CharT>(arr[index]);
+                it[-3] = static_cast<CharT>('0' + hundreds);
+                it[-4] = sep;
+                it -= 4;
+            }
+        } else if (grp < 20) {
+            const auto p10 = strf::detail::pow10(grp);
+            while (uvalue >= p10) {
+                const auto group = static_cast<unsigned long long>(uvalue % p10);
+                uvalue = static_cast<UIntT>(uvalue / p10);
+                CharT* const group_begin = it - grp;
+                it = write_txtdigits_backwards(group, it);
+                while (it != group_begin) {
+                    *--it = static_cast<CharT>('0');
+                }
+                *--it = sep;
+            }
+        }
+        write_txtdigits_backwards(uvalue, it);
+    }
+
     template <typename UIntT, typename CharT>
     static STRF_HD void write_txtdigits_backwards_little_sep
         ( CharT* it
@@ -637,39 +871,10 @@ public:
         const char* arr = strf::detail::chars_00_to_99();
         auto digits_before_sep = git.current();
 
-        // if (git.shall_repeat_current() && digits_before_sep > 1) { // common case ( optimization )
-        //     auto group_size = digits_before_sep;
-        //     while (1) {
-        //         if (uvalue < 10) {
-        //             if (uvalue) {
-        //                 *--it = static_cast<CharT>('0' + uvalue);
-        //             }
-        //             return;
-        //         }
-        //         auto dig_index = static_cast<std::uint8_t>((uvalue % 100) << 1);
-        //         uvalue /= 100;
-        //         if (digits_before_sep >= 2) {
-        //             it[-1] = arr[dig_index + 1];
-        //             it[-2] = arr[dig_index];
-        //             if (uvalue == 0) {
-        //                 return;
-        //             }
-        //             it -= 2;
-        //             if (digits_before_sep == 2) {
-        //                 *--it = sep;
-        //                 digits_before_sep = group_size;
-        //             } else {
-        //                 digits_before_sep -= 2;
-        //             }
-        //         } else {
-        //             it[-1] = arr[dig_index + 1];
-        //             it[-2] = sep;
-        //             it[-3] = arr[dig_index];
-        //             it -=3;
-        //             digits_before_sep = group_size - 1;
-        //         }
-        //     }
-        // }
+        if (git.shall_repeat_current()) {
+            write_txtdigits_backwards_uniform_sep(it, uvalue, digits_before_sep, sep);
+            return;
+        }
         while (1) {
             if (uvalue < 10) {
                 STRF_ASSERT(uvalue != 0);
@@ -739,6 +944,29 @@ public:
     }
 };
 
+// Returns the eight hexadecimal digits of x in ASCII, one per byte,
+// the least significant digit in the lowest byte.
+inline STRF_HD std::uint64_t hex_digits_swar(std::uint32_t x, strf::lettercase lc) noexcept
+{
+    std::uint64_t w = x;
+    w = ((w & 0xFFFF0000ULL) << 16) | (w & 0xFFFFULL);
+    w = ((w & 0x0000FF000000FF00ULL) << 8) | (w & 0x000000FF000000FFULL);
+    w = ((w & 0x00F000F000F000F0ULL) << 4) | (w & 0x000F000F000F000FULL);
+    // each byte of `letters` is 1 where the digit is greater than 9
+    const std::uint64_t letters = ((w + 0x0606060606060606ULL) >> 4) & 0x0101010101010101ULL;
+    const std::uint64_t letters_offset = lc == strf::lowercase ? 'a' - '0' - 10 : 'A' - '0' - 10;
+    return w + 0x3030303030303030ULL + letters * letters_offset;
+}
+
+// Returns the eight binary digits of x in ASCII, one per byte,
+// the least significant digit in the lowest byte.
+inline STRF_HD std::uint64_t bin_digits_swar(std::uint8_t x) noexcept
+{
+    std::uint64_t w = (x * 0x0101010101010101ULL) & 0x8040201008040201ULL;
+    w = ((w + 0x7F7F7F7F7F7F7F7FULL) >> 7) & 0x0101010101010101ULL;
+    return w + 0x3030303030303030ULL;
+}
+
 template <>
 class intdigits_backwards_writer<16>
 {
@@ -752,18 +980,27 @@ public:
     {
         using uIntT = typename std::make_unsigned<IntT>::type;
         uIntT uvalue = value;
-        const char offset_digit_a = ('A' | ((lc == strf::lowercase) << 5)) - 10;
-        while(uvalue > 0xF) {
-            auto digit = uvalue & 0xF;
-            *--it = ( digit < 10
-                    ? static_cast<CharT>('0' + digit)
-                    : static_cast<CharT>(offset_digit_a + digit) );
-            uvalue >>= 4;
+        // Eight digits at a time while there are at least eight
+        while ((uvalue >> 28) != 0) {
+            auto digits = hex_digits_swar(static_cast<std::uint32_t>(uvalue), lc);
+            for (int i = 0; i < 8; ++i) {
+                *--it = static_cast<CharT>(digits & 0xFF);
+                digits >>= 8;
+            }
+            // ( uvalue >> 16 >> 16 ) instead of ( uvalue >> 32 ), since
+            // the latter is undefined when uIntT has 32 bits
+            uvalue = static_cast<uIntT>(uvalue >> 16 >> 16);
+            if (uvalue == 0) {
+                return it;
+            }
         }
-        auto digit = uvalue & 0xF;
-        *--it = ( digit < 10
-                ? static_cast<CharT>('0' + digit)
-                : static_cast<CharT>(offset_digit_a + digit) );
+        const char* hex_digits = ( lc == strf::lowercase
+                                 ? "0123456789abcdef"
+                                 : "0123456789ABCDEF" );
+        do {
+            *--it = static_cast<CharT>(hex_digits[uvalue & 0xF]);
+            uvalue = static_cast<uIntT>(uvalue >> 4);
+        } while (uvalue != 0);
         return it;
     }
 
@@ -878,6 +1115,140 @@ inline STRF_HD CharT* write_int_dec_txtdigits_backwards(IntT value, CharT* it) n
     return intdigits_backwards_writer<10>::write_txtdigits_backwards(value, it);
 }
 
+// Writing decimal digits forward, i.e. without knowing in advance how
+// many digits there are. The value is split in chunks of up to 8 digits,
+// and each chunk is split with multiplications and shifts into pairs of
+// digits, which are copied from chars_00_to_99().
+
+template <typename CharT>
+inline STRF_HD void write_2_dec_txtdigits(CharT* it, std::uint32_t value) noexcept
+{
+    STRF_ASSERT(value < 100);
+    const char* arr = strf::detail::chars_00_to_99() + (value << 1);
+    it[0] = static_cast<CharT>(arr[0]);
+    it[1] = static_cast<CharT>(arr[1]);
+}
+
+template <typename CharT>
+inline STRF_HD void write_4_dec_txtdigits(CharT* it, std::uint32_t value) noexcept
+{
+    STRF_ASSERT(value < 10000);
+    // (x * 5243) >> 19 == x / 100 for any x < 43699
+    const std::uint32_t hi = (value * 5243) >> 19;
+    strf::detail::write_2_dec_txtdigits(it, hi);
+    strf::detail::write_2_dec_txtdigits(it + 2, value - hi * 100);
+}
+
+template <typename CharT>
+inline STRF_HD void write_8_dec_txtdigits(CharT* it, std::uint32_t value) noexcept
+{
+    STRF_ASSERT(value < 100000000);
+    // (x * 109951163) >> 40 == x / 10000 for any x < 10^8
+    const auto hi = static_cast<std::uint32_t>
+        ((static_cast<std::uint64_t>(value) * 109951163) >> 40);
+    strf::detail::write_4_dec_txtdigits(it, hi);
+    strf::detail::write_4_dec_txtdigits(it + 4, value - hi * 10000);
+}
+
+// writes the digits of a value less than 100, without leading zero
+template <typename CharT>
+inline STRF_HD CharT* write_1_or_2_dec_txtdigits(CharT* it, std::uint32_t value) noexcept
+{
+    STRF_ASSERT(value < 100);
+    if (value < 10) {
+        *it = static_cast<CharT>('0' + value);
+        return it + 1;
+    }
+    strf::detail::write_2_dec_txtdigits(it, value);
+    return it + 2;
+}
+
+// writes the digits of a value less than 10^8, without leading zeros
+template <typename CharT>
+inline STRF_HD CharT* write_up_to_8_dec_txtdigits(CharT* it, std::uint32_t value) noexcept
+{
+    STRF_ASSERT(value < 100000000);
+    if (value < 100) {
+        return strf::detail::write_1_or_2_dec_txtdigits(it, value);
+    }
+    if (value < 10000) {
+        const std::uint32_t hi = (value * 5243) >> 19;
+        it = strf::detail::write_1_or_2_dec_txtdigits(it, hi);
+        strf::detail::write_2_dec_txtdigits(it, value - hi * 100);
+        return it + 2;
+    }
+    if (value < 1000000) {
+        const auto hi = static_cast<std::uint32_t>
+            ((static_cast<std::uint64_t>(value) * 109951163) >> 40);
+        it = strf::detail::write_1_or_2_dec_txtdigits(it, hi);
+        strf::detail::write_4_dec_txtdigits(it, value - hi * 10000);
+        return it + 4;
+    }
+    const std::uint32_t hi = value / 1000000;
+    it = strf::detail::write_1_or_2_dec_txtdigits(it, hi);
+    const std::uint32_t lo = value - hi * 1000000;
+    const std::uint32_t mid = lo / 10000;
+    strf::detail::write_2_dec_txtdigits(it, mid);
+    strf::detail::write_4_dec_txtdigits(it + 2, lo - mid * 10000);
+    return it + 6;
+}
+
+// Writes the decimal digits of value starting at it, and returns the
+// end of what was written. There must be space for 20 characters.
+template <typename CharT>
+inline STRF_HD CharT* write_int_dec_txtdigits_forward
+    ( unsigned long long value, CharT* it ) noexcept
+{
+    constexpr unsigned long long e8 = 100000000ull;
+    if (value < e8) {
+        return strf::detail::write_up_to_8_dec_txtdigits(it, static_cast<std::uint32_t>(value));
+    }
+    if (value < e8 * e8) {
+        const unsigned long long hi = value / e8;
+        it = strf::detail::write_up_to_8_dec_txtdigits(it, static_cast<std::uint32_t>(hi));
+        strf::detail::write_8_dec_txtdigits(it, static_cast<std::uint32_t>(value - hi * e8));
+        return it + 8;
+    }
+    const unsigned long long hi = value / (e8 * e8);   // less than 1845
+    const unsigned long long lo = value - hi * (e8 * e8);
+    const unsigned long long mid = lo / e8;
+    it = strf::detail::write_up_to_8_dec_txtdigits(it, static_cast<std::uint32_t>(hi));
+    strf::detail::write_8_dec_txtdigits(it, static_cast<std::uint32_t>(mid));
+    strf::detail::write_8_dec_txtdigits(it + 8, static_cast<std::uint32_t>(lo - mid * e8));
+    return it + 16;
+}
+
+#if defined(STRF_HAS_INT128)
+
+// There must be space for 39 characters
+template <typename CharT>
+inline STRF_HD CharT* write_int_dec_txtdigits_forward
+    ( strf::detail::uint128_t value, CharT* it ) noexcept
+{
+    if ((value >> 64) == 0) {
+        return strf::detail::write_int_dec_txtdigits_forward
+            ( static_cast<unsigned long long>(value), it );
+    }
+    // the value is split into a quotient and the 19 lowest digits
+    constexpr unsigned long long e8 = 100000000ull;
+    constexpr unsigned long long e19 = 10000000000000000000ull;
+    const strf::detail::uint128_t quotient = value / e19;
+    const auto chunk = static_cast<unsigned long long>(value - quotient * e19);
+    it = strf::detail::write_int_dec_txtdigits_forward(quotient, it);
+
+    const auto hi = static_cast<std::uint32_t>(chunk / (e8 * e8)); // less than 1000
+    const unsigned long long lo = chunk - hi * (e8 * e8);
+    const unsigned long long mid = lo / e8;
+    const std::uint32_t hi_hi = (hi * 5243) >> 19;
+    *it = static_cast<CharT>('0' + hi_hi);
+    strf::detail::write_2_dec_txtdigits(it + 1, hi - hi_hi * 100);
+    strf::detail::write_8_dec_txtdigits(it + 3, static_cast<std::uint32_t>(mid));
+    strf::detail::write_8_dec_txtdigits(it + 11, static_cast<std::uint32_t>(lo - mid * e8));
+    return it + 19;
+}
+
+#endif // defined(STRF_HAS_INT128)
+
 template <typename IntT, typename CharT>
 inline STRF_HD CharT* write_int_hex_txtdigits_backwards
     (IntT value, CharT* it, strf::lettercase lc) noexcept
@@ -1072,21 +1443,28 @@ public:
             strf::put(dest, static_cast<CharT>('0' + value));
             return;
         }
+        // Eight digits at a time, starting with the highest chunk,
+        // which has the remaining ( digcount % 8 ) digits, if any.
         auto it = dest.buffer_ptr();
         auto end = dest.buffer_end();
-        UIntT mask = (UIntT)1 << (digcount - 1);
+        unsigned remaining = digcount;
+        unsigned chunk_size = ((digcount - 1) & 7) + 1;
         do {
-            if (it == end) {
-                dest.advance_to(it);
-                dest.recycle();
-                it = dest.buffer_ptr();
-                end = dest.buffer_end();
-            }
-            *it = (CharT)'0' + (0 != (value & mask));
-            ++it;
-            mask = mask >> 1;
-        }
-        while(mask != 0);
+            remaining -= chunk_size;
+            auto digits = bin_digits_swar(static_cast<std::uint8_t>(value >> remaining));
+            digits <<= 8 * (8 - chunk_size);
+            do {
+                if (it == end) {
+                    dest.advance_to(it);
+                    dest.recycle();
+                    it = dest.buffer_ptr();
+                    end = dest.buffer_end();
+                }
+                *it++ = static_cast<CharT>(digits >> 56);
+                digits <<= 8;
+            } while (--chunk_size);
+            chunk_size = 8;
+        } while (remaining != 0);
 
         dest.advance_to(it);
     }
@@ -987,7 +987,21 @@ inline STRF_HD void print_amplified_integer_small_separator
     , unsigned num_trailing_zeros
     , CharT separator )
 {
-    auto dist = grouping.distribute(num_digits + num_trailing_zeros);
+    const unsigned total_digits = num_digits + num_trailing_zeros;
+    auto git = grouping.get_iterator();
+    if (git.shall_repeat_current() && total_digits <= 19) {
+        // Uniform grouping and the amplified value fits in unsigned long long
+        const auto grp = git.current();
+        const auto size = total_digits + (total_digits - 1) / grp;
+        STRF_ASSERT(size <= strf::min_space_after_recycle<CharT>());
+        dest.ensure(size);
+        auto end = dest.buffer_ptr() + size;
+        detail::intdigits_backwards_writer<10>::write_txtdigits_backwards_uniform_sep
+            ( end, value * strf::detail::pow10(num_trailing_zeros), grp, separator );
+        dest.advance_to(end);
+        return;
+    }
+    auto dist = grouping.distribute(total_digits);
     if (num_digits <= dist.highest_group) {
         print_amplified_integer_small_separator_1
             ( dest, value, num_digits, dist, separator );
@@ -0,0 +1,241 @@
+#ifndef STRF_DETAIL_INPUT_TYPES_HEX_BYTES_HPP
+#define STRF_DETAIL_INPUT_TYPES_HEX_BYTES_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <strf/printer.hpp>
+#include <strf/detail/facets/lettercase.hpp>
+#include <strf/detail/simd.hpp>
+
+namespace strf {
+
+struct hex_bytes_p
+{
+    const unsigned char* bytes;
+    std::size_t count;
+    char sep; // printed between each pair of bytes, unless it is zero
+};
+
+inline STRF_HD strf::hex_bytes_p hex_bytes
+    ( const void* bytes, std::size_t count, char sep = '\0' ) noexcept
+{
+    return {static_cast<const unsigned char*>(bytes), count, sep};
+}
+
+namespace detail {
+
+template <typename CharT> class hex_bytes_printer;
+
+} // namespace detail
+
+template <>
+struct print_traits<strf::hex_bytes_p>
+{
+    using forwarded_type = strf::hex_bytes_p;
+    using formatters = strf::tag<strf::alignment_formatter>;
+
+    template <typename CharT, typename Preview, typename FPack>
+    constexpr STRF_HD static auto make_printer_input
+        ( strf::tag<CharT>
+        , Preview& preview
+        , const FPack& fp
+        , strf::hex_bytes_p x ) noexcept
+        -> strf::usual_printer_input
+            < CharT, Preview, FPack, strf::hex_bytes_p
+            , strf::detail::hex_bytes_printer<CharT> >
+    {
+        return {preview, fp, x};
+    }
+
+    template <typename CharT, typename Preview, typename FPack, typename... T>
+    constexpr STRF_HD static auto make_printer_input
+        ( strf::tag<CharT>
+        , Preview& preview
+        , const FPack& fp
+        , strf::value_with_formatters<T...> x ) noexcept
+        -> strf::usual_printer_input
+            < CharT, Preview, FPack
+            , strf::value_with_formatters<T...>
+            , strf::detail::hex_bytes_printer<CharT> >
+    {
+        return {preview, fp, x};
+    }
+};
+
+namespace detail {
+
+template <typename CharT>
+class hex_bytes_printer: public printer<CharT>
+{
+public:
+
+    template <typename Preview, typename FPack>
+    STRF_HD hex_bytes_printer
+        ( const strf::usual_printer_input
+            < CharT, Preview, FPack, strf::hex_bytes_p, hex_bytes_printer >& input )
+        : data_(input.arg)
+        , lettercase_(strf::use_facet<strf::lettercase_c, strf::hex_bytes_p>(input.facets))
+    {
+        const auto size = content_size_();
+        input.preview.subtract_width(size);
+        input.preview.add_size(size);
+    }
+
+    template <typename Preview, typename FPack, typename... T>
+    STRF_HD hex_bytes_printer
+        ( const strf::usual_printer_input
+            < CharT, Preview, FPack, strf::value_with_formatters<T...>
+            , hex_bytes_printer >& input )
+        : data_(input.arg.value())
+        , afmt_(input.arg.get_alignment_format())
+        , lettercase_(strf::use_facet<strf::lettercase_c, strf::hex_bytes_p>(input.facets))
+    {
+        auto charset = strf::use_facet<charset_c<CharT>, strf::hex_bytes_p>(input.facets);
+        const auto size = content_size_();
+        const auto fmt_width = afmt_.width.round();
+        if (fmt_width > 0 && static_cast<std::size_t>(fmt_width) > size) {
+            encode_fill_ = charset.encode_fill_func();
+            fillcount_ = static_cast<std::uint16_t>(fmt_width - static_cast<int>(size));
+            input.preview.subtract_width(fmt_width);
+            input.preview.add_size(size + fillcount_ * charset.encoded_char_size(afmt_.fill));
+        } else {
+            input.preview.subtract_width(size);
+            input.preview.add_size(size);
+        }
+    }
+
+    STRF_HD void print_to(strf::destination<CharT>& dest) const override;
+
+private:
+
+    STRF_HD std::size_t content_size_() const noexcept
+    {
+        if (data_.count == 0) {
+            return 0;
+        }
+        return data_.sep == '\0' ? 2 * data_.count : 3 * data_.count - 1;
+    }
+
+    STRF_HD void print_bytes_(strf::destination<CharT>& dest) const;
+
+    strf::hex_bytes_p data_;
+    strf::encode_fill_f<CharT> encode_fill_ = nullptr;
+    std::uint16_t fillcount_ = 0;
+    strf::alignment_format afmt_;
+    strf::lettercase lettercase_;
+};
+
+template <typename CharT>
+STRF_HD void hex_bytes_printer<CharT>::print_to(strf::destination<CharT>& dest) const
+{
+    decltype(fillcount_) right_fillcount = 0;
+    if (fillcount_ > 0) {
+        decltype(fillcount_) left_fillcount;
+        switch (afmt_.alignment) {
+            case strf::text_alignment::left:
+                left_fillcount = 0;
+                right_fillcount = fillcount_;
+                break;
+            case strf::text_alignment::right:
+                left_fillcount = fillcount_;
+                break;
+            default:
+                left_fillcount = fillcount_ >> 1;
+                right_fillcount = fillcount_ - left_fillcount;
+        }
+        if (left_fillcount != 0) {
+            encode_fill_(dest, left_fillcount, afmt_.fill);
+        }
+    }
+    print_bytes_(dest);
+    if (right_fillcount != 0) {
+        encode_fill_(dest, right_fillcount, afmt_.fill);
+    }
+}
+
+template <typename CharT>
+STRF_HD void hex_bytes_printer<CharT>::print_bytes_(strf::destination<CharT>& dest) const
+{
+    const unsigned char* src = data_.bytes;
+    const unsigned char* src_end = src + data_.count;
+
+#if defined(STRF_HAS_SIMD)
+    STRF_IF_CONSTEXPR (sizeof(CharT) == 1) {
+        if (data_.sep == '\0') {
+            const std::uint8_t letters_offset =
+                lettercase_ == strf::lowercase ? 'a' - '0' - 10 : 'A' - '0' - 10;
+            while (src != src_end) {
+                dest.ensure(2);
+                const std::size_t count = strf::detail::min<std::size_t>
+                    (src_end - src, dest.buffer_space() / 2);
+                strf::detail::simd::hex_encode
+                    ( src, count, reinterpret_cast<std::uint8_t*>(dest.buffer_ptr())
+                    , letters_offset );
+                dest.advance(2 * count);
+                src += count;
+            }
+            return;
+        }
+    }
+#endif // defined(STRF_HAS_SIMD)
+
+    if (src == src_end) {
+        return;
+    }
+    const char* hex_digits = ( lettercase_ == strf::lowercase
+                             ? "0123456789abcdef"
+                             : "0123456789ABCDEF" );
+    // the first byte is not preceded by the separator
+    dest.ensure(2);
+    auto it = dest.buffer_ptr();
+    auto end = dest.buffer_end();
+    it[0] = static_cast<CharT>(hex_digits[*src >> 4]);
+    it[1] = static_cast<CharT>(hex_digits[*src & 0xF]);
+    it += 2;
+    ++src;
+
+    const bool has_sep = data_.sep != '\0';
+    const auto sep = static_cast<CharT>(data_.sep);
+    const std::size_t size_per_byte = 2 + has_sep;
+    while (src != src_end) {
+        std::size_t space = static_cast<std::size_t>(end - it);
+        if (space < size_per_byte) {
+            dest.advance_to(it);
+            dest.recycle();
+            it = dest.buffer_ptr();
+            end = dest.buffer_end();
+            space = static_cast<std::size_t>(end - it);
+        }
+        const auto count = strf::detail::min<std::size_t>(src_end - src, space / size_per_byte);
+        for (const auto* chunk_end = src + count; src != chunk_end; ++src) {
+            if (has_sep) {
+                *it++ = sep;
+            }
+            it[0] = static_cast<CharT>(hex_digits[*src >> 4]);
+            it[1] = static_cast<CharT>(hex_digits[*src & 0xF]);
+            it += 2;
+        }
+    }
+    dest.advance_to(it);
+}
+
+#if defined(STRF_SEPARATE_COMPILATION)
+
+#if defined(__cpp_char8_t)
+STRF_EXPLICIT_TEMPLATE class hex_bytes_printer<char8_t>;
+#endif
+
+STRF_EXPLICIT_TEMPLATE class hex_bytes_printer<char>;
+STRF_EXPLICIT_TEMPLATE class hex_bytes_printer<char16_t>;
+STRF_EXPLICIT_TEMPLATE class hex_bytes_printer<char32_t>;
+STRF_EXPLICIT_TEMPLATE class hex_bytes_printer<wchar_t>;
+
+#endif // defined(STRF_SEPARATE_COMPILATION)
+
+} // namespace detail
+} // namespace strf
+
+#endif  // STRF_DETAIL_INPUT_TYPES_HEX_BYTES_HPP
@@ -1070,11 +1070,26 @@ private:
 
 namespace detail {
 
-template <typename> class default_int_printer;
-template <typename> class aligned_default_int_printer;
-template <typename, int Base> class int_printer_no_pad0_nor_punct;
-template <typename, int Base, bool Punctuate> class int_printer_static_base_and_punct;
-template <typename> class int_printer_full_dynamic;
+// The template parameter UIntT is the type in which the printers store
+// the absolute value. It is only different from unsigned long long for
+// the 128-bit integers.
+
+template <typename, typename UIntT = unsigned long long>
+class default_int_printer;
+template <typename, typename UIntT = unsigned long long>
+class aligned_default_int_printer;
+template <typename, int Base, typename UIntT = unsigned long long>
+class int_printer_no_pad0_nor_punct;
+template <typename, int Base, bool Punctuate, typename UIntT = unsigned long long>
+class int_printer_static_base_and_punct;
+template <typename, typename UIntT = unsigned long long>
+class int_printer_full_dynamic;
+
+template <typename IntT>
+using int_printer_uint_t = strf::detail::conditional_t
+    < (sizeof(IntT) > sizeof(unsigned long long))
+    , typename std::make_unsigned<IntT>::type
+    , unsigned long long >;
 
 template <typename T>
 constexpr STRF_HD bool negative_impl_(const T& x, std::integral_constant<bool, true>) noexcept
@@ -1123,7 +1138,8 @@ struct int_printing;
 template <typename CharT, typename Preview, typename IntT>
 struct default_int_printer_input
 {
-    using printer_type = strf::detail::default_int_printer<CharT>;
+    using printer_type = strf::detail::default_int_printer
+        < CharT, strf::detail::int_printer_uint_t<IntT> >;
 
     template<typename FPack>
     constexpr STRF_HD default_int_printer_input
@@ -1174,6 +1190,9 @@ private:
     using vwf_full_dynamic_ = value_with_formatters
               < P, int_formatter_full_dynamic
               , alignment_formatter_q<HasAlignment> >;
+
+    using uint_ = strf::detail::int_printer_uint_t<IntT>;
+
 public:
 
     using override_tag = IntT;
@@ -1203,8 +1222,8 @@ public:
             < CharT, Preview, FPack, vwf_nopp_<PTraits, Base, HasAlignment>
             , strf::detail::conditional_t
                 < HasAlignment
-                , strf::detail::int_printer_static_base_and_punct<CharT, Base, false>
-                , strf::detail::int_printer_no_pad0_nor_punct<CharT, Base> > >
+                , strf::detail::int_printer_static_base_and_punct<CharT, Base, false, uint_>
+                , strf::detail::int_printer_no_pad0_nor_punct<CharT, Base, uint_> > >
     {
         return {preview, facets, x};
     }
@@ -1218,7 +1237,7 @@ public:
         , vwf_bp_<PTraits, Base, Punctuate, HasAlignment> x )
         -> strf::usual_printer_input
             < CharT, Preview, FPack, vwf_bp_<PTraits, Base, Punctuate, HasAlignment>
-            , strf::detail::int_printer_static_base_and_punct<CharT, Base, Punctuate> >
+            , strf::detail::int_printer_static_base_and_punct<CharT, Base, Punctuate, uint_> >
     {
         return {preview, facets, x};
     }
@@ -1235,7 +1254,7 @@ public:
             , strf::detail::default_int_printer_input<CharT, Preview, IntT>
             , strf::usual_printer_input
                 < CharT, Preview, FPack, vwf_<PTraits, HasAlignment>
-                , strf::detail::aligned_default_int_printer<CharT> > >
+                , strf::detail::aligned_default_int_printer<CharT, uint_> > >
     {
         return {preview, facets, x};
     }
@@ -1249,7 +1268,7 @@ public:
         , vwf_full_dynamic_<PTraits, HasAlignment> x )
         -> strf::usual_printer_input
                 < CharT, Preview, FPack, vwf_full_dynamic_<PTraits, HasAlignment>
-                , strf::detail::int_printer_full_dynamic<CharT> >
+                , strf::detail::int_printer_full_dynamic<CharT, uint_> >
     {
         return {preview, facets, x};
     }
@@ -1279,6 +1298,15 @@ template <> struct print_traits<unsigned long>:
 template <> struct print_traits<unsigned long long>:
     public strf::detail::int_printing<unsigned long long> {};
 
+#if defined(STRF_HAS_INT128)
+
+template <> struct print_traits<strf::detail::int128_t>:
+    public strf::detail::int_printing<strf::detail::int128_t> {};
+template <> struct print_traits<strf::detail::uint128_t>:
+    public strf::detail::int_printing<strf::detail::uint128_t> {};
+
+#endif // defined(STRF_HAS_INT128)
+
 constexpr STRF_HD auto tag_invoke(strf::print_traits_tag, signed char) noexcept
     -> strf::detail::int_printing<signed char>
     { return {}; }
@@ -1319,6 +1347,18 @@ constexpr STRF_HD auto tag_invoke(strf::print_traits_tag, unsigned long long) no
     -> strf::detail::int_printing<unsigned long long>
     { return {}; }
 
+#if defined(STRF_HAS_INT128)
+
+constexpr STRF_HD auto tag_invoke(strf::print_traits_tag, strf::detail::int128_t) noexcept
+    -> strf::detail::int_printing<strf::detail::int128_t>
+    { return {}; }
+
+constexpr STRF_HD auto tag_invoke(strf::print_traits_tag, strf::detail::uint128_t) noexcept
+    -> strf::detail::int_printing<strf::detail::uint128_t>
+    { return {}; }
+
+#endif // defined(STRF_HAS_INT128)
+
 namespace detail {
 
 struct voidptr_printing
@@ -1384,7 +1424,7 @@ constexpr STRF_HD auto tag_invoke(strf::print_traits_tag, const void*) noexcept
 
 namespace detail {
 
-template <typename CharT>
+template <typename CharT, typename UIntT>
 class default_int_printer: public strf::printer<CharT>
 {
 public:
@@ -1414,43 +1454,59 @@ private:
             uvalue = unsigned_abs(value);
         }
         uvalue_ = uvalue;
-        digcount_ = strf::detail::count_digits<10>(uvalue);
-        preview.subtract_width(digcount_ + negative_);
-        preview.add_size(digcount_ + negative_);
+        STRF_IF_CONSTEXPR (Preview::something_required) {
+            digcount_ = strf::detail::count_digits<10>(uvalue);
+            preview.subtract_width(digcount_ + negative_);
+            preview.add_size(digcount_ + negative_);
+        }
     }
 
    template < typename Preview
-            , typename UIntT
-            , strf::detail::enable_if_t< ! std::is_signed<UIntT>::value, int> = 0 >
-    STRF_HD void init_(Preview& preview, UIntT value)
+            , typename UnsignedIntT
+            , strf::detail::enable_if_t< ! std::is_signed<UnsignedIntT>::value, int> = 0 >
+    STRF_HD void init_(Preview& preview, UnsignedIntT value)
     {
         uvalue_ = value;
         negative_ = false;
-        digcount_ = strf::detail::count_digits<10>(value);
-        preview.subtract_width(digcount_);
-        preview.add_size(digcount_);
+        STRF_IF_CONSTEXPR (Preview::something_required) {
+            digcount_ = strf::detail::count_digits<10>(value);
+            preview.subtract_width(digcount_);
+            preview.add_size(digcount_);
+        }
     }
 
-    unsigned long long uvalue_;
-    unsigned digcount_;
+    UIntT uvalue_;
+    unsigned digcount_ = 0; // zero when not calculated in the constructor
     bool negative_;
 };
 
-template <typename CharT>
-STRF_HD void default_int_printer<CharT>::print_to
+template <typename CharT, typename UIntT>
+STRF_HD void default_int_printer<CharT, UIntT>::print_to
     ( strf::destination<CharT>& dest ) const
 {
-    dest.ensure(digcount_ + negative_);
+    // When there is space for the longest possible value, the digits
+    // are written forward, without the need to know how many they are.
+    constexpr unsigned max_digits = strf::detail::max_num_digits<UIntT, 10>();
+    STRF_IF_LIKELY (dest.buffer_space() > max_digits) {
+        auto* it = dest.buffer_ptr();
+        if (negative_) {
+            *it++ = '-';
+        }
+        dest.advance_to(strf::detail::write_int_dec_txtdigits_forward(uvalue_, it));
+        return;
+    }
+    const unsigned digcount = digcount_ != 0 ? digcount_ : strf::detail::count_digits<10>(uvalue_);
+    dest.ensure(digcount + negative_);
     auto* it = dest.buffer_ptr();
     if (negative_) {
         *it++ = '-';
     }
-    it += digcount_;
+    it += digcount;
     write_int_dec_txtdigits_backwards(uvalue_, it);
     dest.advance_to(it);
 }
 
-template <typename CharT>
+template <typename CharT, typename UIntT>
 class aligned_default_int_printer: public strf::printer<CharT>
 {
 public:
@@ -1493,9 +1549,9 @@ private:
         return digcount_ + negative_;
     }
 
-    template < typename UIntT
-             , strf::detail::enable_if_t< ! std::is_signed<UIntT>::value, int> = 0 >
-    STRF_HD unsigned init_(UIntT value) noexcept
+    template < typename UnsignedIntT
+             , strf::detail::enable_if_t< ! std::is_signed<UnsignedIntT>::value, int> = 0 >
+    STRF_HD unsigned init_(UnsignedIntT value) noexcept
     {
         uvalue_ = value;
         negative_ = false;
@@ -1513,7 +1569,7 @@ private:
     }
 
     strf::encode_fill_f<CharT> encode_fill_;
-    unsigned long long uvalue_;
+    UIntT uvalue_;
     unsigned digcount_;
     unsigned fillcount_;
     strf::text_alignment alignment_;
@@ -1521,8 +1577,8 @@ private:
     bool negative_;
 };
 
-template <typename CharT>
-STRF_HD void aligned_default_int_printer<CharT>::print_to
+template <typename CharT, typename UIntT>
+STRF_HD void aligned_default_int_printer<CharT, UIntT>::print_to
     ( strf::destination<CharT>& dest ) const
 {
     unsigned right_fillcount = 0;
@@ -1555,18 +1611,20 @@ STRF_HD void aligned_default_int_printer<CharT>::print_to
     }
 }
 
+template <typename UIntT>
 struct int_printer_no_pad0_nor_punct_data
 {
-    unsigned long long uvalue;
+    UIntT uvalue;
     unsigned digcount;
     unsigned prefix;
 };
 
 template
-    < typename UIntT
+    < typename DataUIntT
+    , typename UIntT
     , strf::detail::enable_if_t<std::is_unsigned<UIntT>::value, int> = 0 >
 inline STRF_HD unsigned init
-    ( int_printer_no_pad0_nor_punct_data& data
+    ( int_printer_no_pad0_nor_punct_data<DataUIntT>& data
     , int_format_no_pad0_nor_punct<10>
     , UIntT uvalue ) noexcept
 {
@@ -1576,10 +1634,11 @@ inline STRF_HD unsigned init
     return data.digcount;
 }
 
-template < typename IntT
+template < typename DataUIntT
+         , typename IntT
          , strf::detail::enable_if_t<std::is_signed<IntT>::value, int> = 0 >
 inline STRF_HD unsigned init
-    ( int_printer_no_pad0_nor_punct_data& data
+    ( int_printer_no_pad0_nor_punct_data<DataUIntT>& data
     , int_format_no_pad0_nor_punct<10> ifmt
     , IntT value ) noexcept
 {
@@ -1598,10 +1657,11 @@ inline STRF_HD unsigned init
 }
 
 template < int Base
+         , typename DataUIntT
          , typename IntT
          , strf::detail::enable_if_t<Base != 10, int> = 0 >
 inline STRF_HD unsigned init
-    ( int_printer_no_pad0_nor_punct_data& data
+    ( int_printer_no_pad0_nor_punct_data<DataUIntT>& data
     , int_format_no_pad0_nor_punct<Base> ifmt
     , IntT value ) noexcept
 {
@@ -1616,8 +1676,8 @@ inline STRF_HD unsigned init
     return data.digcount + data.prefix;
 }
 
-template <typename CharT>
-class int_printer_no_pad0_nor_punct<CharT, 10>: public strf::printer<CharT>
+template <typename CharT, typename UIntT>
+class int_printer_no_pad0_nor_punct<CharT, 10, UIntT>: public strf::printer<CharT>
 {
 public:
     template <typename... T>
@@ -1641,11 +1701,11 @@ public:
     }
 
 private:
-    int_printer_no_pad0_nor_punct_data data_;
+    int_printer_no_pad0_nor_punct_data<UIntT> data_;
 };
 
-template <typename CharT>
-class int_printer_no_pad0_nor_punct<CharT, 16>: public strf::printer<CharT>
+template <typename CharT, typename UIntT>
+class int_printer_no_pad0_nor_punct<CharT, 16, UIntT>: public strf::printer<CharT>
 {
 public:
 
@@ -1675,13 +1735,13 @@ public:
 
 private:
 
-    int_printer_no_pad0_nor_punct_data data_;
+    int_printer_no_pad0_nor_punct_data<UIntT> data_;
     strf::lettercase lettercase_;
 };
 
 
-template <typename CharT>
-class int_printer_no_pad0_nor_punct<CharT, 8>: public strf::printer<CharT>
+template <typename CharT, typename UIntT>
+class int_printer_no_pad0_nor_punct<CharT, 8, UIntT>: public strf::printer<CharT>
 {
 public:
     template <typename... T>
@@ -1705,11 +1765,11 @@ public:
     }
 
 private:
-    int_printer_no_pad0_nor_punct_data data_;
+    int_printer_no_pad0_nor_punct_data<UIntT> data_;
 };
 
-template <typename CharT>
-class int_printer_no_pad0_nor_punct<CharT, 2>: public strf::printer<CharT>
+template <typename CharT, typename UIntT>
+class int_printer_no_pad0_nor_punct<CharT, 2, UIntT>: public strf::printer<CharT>
 {
 public:
 
@@ -1736,12 +1796,13 @@ public:
     }
 
 private:
-    int_printer_no_pad0_nor_punct_data data_;
+    int_printer_no_pad0_nor_punct_data<UIntT> data_;
     strf::lettercase lettercase_;
 };
 
+template <typename UIntT>
 struct fmt_int_printer_data {
-    unsigned long long uvalue;
+    UIntT uvalue;
     unsigned digcount;
     unsigned leading_zeros;
     unsigned left_fillcount;
@@ -1751,7 +1812,8 @@ struct fmt_int_printer_data {
     char sign;
 };
 
-struct punct_fmt_int_printer_data: public fmt_int_printer_data {
+template <typename UIntT>
+struct punct_fmt_int_printer_data: public fmt_int_printer_data<UIntT> {
     unsigned sepcount;
     unsigned sepsize;
     char32_t sepchar;
@@ -1759,10 +1821,11 @@ struct punct_fmt_int_printer_data: public fmt_int_printer_data {
 };
 
 template
-    < typename IntT
+    < typename DataUIntT
+    , typename IntT
     , strf::detail::enable_if_t<std::is_signed<IntT>::value, int> = 0 >
 inline STRF_HD void init_1
-    ( fmt_int_printer_data& data
+    ( fmt_int_printer_data<DataUIntT>& data
     , strf::default_int_format
     , IntT value ) noexcept
 {
@@ -1783,10 +1846,11 @@ inline STRF_HD void init_1
 }
 
 template
-    < typename UIntT
+    < typename DataUIntT
+    , typename UIntT
     , strf::detail::enable_if_t<!std::is_signed<UIntT>::value, int> = 0 >
 inline STRF_HD void init_1
-    ( fmt_int_printer_data& data
+    ( fmt_int_printer_data<DataUIntT>& data
     , strf::default_int_format
     , UIntT uvalue ) noexcept
 {
@@ -1796,11 +1860,12 @@ inline STRF_HD void init_1
 }
 
 template
-    < typename IntT
+    < typename DataUIntT
+    , typename IntT
     , bool Punctuate
     , strf::detail::enable_if_t<std::is_signed<IntT>::value, int> = 0 >
 inline STRF_HD void init_1
-    ( fmt_int_printer_data& data
+    ( fmt_int_printer_data<DataUIntT>& data
     , strf::int_format_static_base_and_punct<10, Punctuate> ifmt
     , IntT value ) noexcept
 {
@@ -1822,11 +1887,12 @@ inline STRF_HD void init_1
 }
 
 template
-    < typename UIntT
+    < typename DataUIntT
+    , typename UIntT
     , bool Punctuate
     , strf::detail::enable_if_t<std::is_unsigned<UIntT>::value, int> = 0 >
 inline STRF_HD void init_1
-    ( fmt_int_printer_data& data
+    ( fmt_int_printer_data<DataUIntT>& data
     , strf::int_format_static_base_and_punct<10, Punctuate>
     , UIntT uvalue ) noexcept
 {
@@ -1835,9 +1901,9 @@ inline STRF_HD void init_1
     data.uvalue = uvalue;
 }
 
-template <typename IntT, bool Punctuate, int Base>
+template <typename DataUIntT, typename IntT, bool Punctuate, int Base>
 inline STRF_HD void init_1
-    ( fmt_int_printer_data& data
+    ( fmt_int_printer_data<DataUIntT>& data
     , strf::int_format_static_base_and_punct<Base, Punctuate>
     , IntT value ) noexcept
 {
@@ -1849,9 +1915,9 @@ struct fmt_int_printer_data_init_result {
     unsigned fillcount;
 };
 
-template <int Base>
+template <int Base, typename UIntT>
 STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data
-    ( fmt_int_printer_data& data
+    ( fmt_int_printer_data<UIntT>& data
     , strf::int_format_static_base_and_punct<Base, false> ifmt
     , strf::default_alignment_format ) noexcept
 {
@@ -1885,9 +1951,9 @@ STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data
     return {content_width, 0};
 }
 
-template <int Base>
+template <int Base, typename UIntT>
 STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data
-    ( fmt_int_printer_data& data
+    ( fmt_int_printer_data<UIntT>& data
     , strf::int_format_static_base_and_punct<Base, false> ifmt
     , strf::alignment_format afmt ) noexcept
 #if defined(STRF_OMIT_IMPL)
@@ -1949,8 +2015,8 @@ STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data
 
 #endif // defined(STRF_OMIT_IMPL)
 
-template <typename CharT, int Base>
-class int_printer_static_base_and_punct<CharT, Base, false>: public printer<CharT>
+template <typename CharT, int Base, typename UIntT>
+class int_printer_static_base_and_punct<CharT, Base, false, UIntT>: public printer<CharT>
 {
 public:
 
@@ -1986,12 +2052,12 @@ public:
 private:
 
     strf::encode_fill_f<CharT> encode_fill_;
-    strf::detail::fmt_int_printer_data data_;
+    strf::detail::fmt_int_printer_data<UIntT> data_;
     strf::lettercase lettercase_;
 };
 
-template <typename CharT, int Base>
-STRF_HD void int_printer_static_base_and_punct<CharT, Base, false>::print_to
+template <typename CharT, int Base, typename UIntT>
+STRF_HD void int_printer_static_base_and_punct<CharT, Base, false, UIntT>::print_to
     ( strf::destination<CharT>& dest ) const
 {
     if (data_.left_fillcount > 0) {
@@ -2024,9 +2090,9 @@ STRF_HD void int_printer_static_base_and_punct<CharT, Base, false>::print_to
     }
 }
 
-template <int Base>
+template <int Base, typename UIntT>
 STRF_HD fmt_int_printer_data_init_result init_punct_fmt_int_printer_data
-    ( punct_fmt_int_printer_data& data
+    ( punct_fmt_int_printer_data<UIntT>& data
     , strf::validate_f validate
     , strf::int_format_static_base_and_punct<Base, true> ifmt
     , strf::alignment_format afmt ) noexcept
@@ -2098,8 +2164,8 @@ STRF_HD fmt_int_printer_data_init_result init_punct_fmt_int_printer_data
 }
 #endif // defined(STRF_OMIT_IMPL)
 
-template <typename CharT, int Base>
-class int_printer_static_base_and_punct<CharT, Base, true>: public printer<CharT>
+template <typename CharT, int Base, typename UIntT>
+class int_printer_static_base_and_punct<CharT, Base, true, UIntT>: public printer<CharT>
 {
 public:
 
@@ -2170,12 +2236,12 @@ private:
 
     strf::encode_fill_f<CharT> encode_fill_;
     strf::encode_char_f<CharT> encode_char_;
-    strf::detail::punct_fmt_int_printer_data data_;
+    strf::detail::punct_fmt_int_printer_data<UIntT> data_;
     strf::lettercase lettercase_;
 };
 
-template <typename CharT, int Base>
-STRF_HD void int_printer_static_base_and_punct<CharT, Base, true>::print_to
+template <typename CharT, int Base, typename UIntT>
+STRF_HD void int_printer_static_base_and_punct<CharT, Base, true, UIntT>::print_to
         ( strf::destination<CharT>& dest ) const
 {
     if (data_.left_fillcount > 0) {
@@ -2224,7 +2290,7 @@ STRF_HD void int_printer_static_base_and_punct<CharT, Base, true>::print_to
 }
 
 
-template <typename CharT>
+template <typename CharT, typename UIntT>
 class int_printer_full_dynamic
 {
 public:
@@ -2250,7 +2316,7 @@ public:
                     grp = numpunct.grouping();
                     thousands_sep = numpunct.thousands_sep();
                 }
-                new ((void*)&storage_) int_printer_static_base_and_punct<CharT, 16, true>
+                new ((void*)&storage_) int_printer_static_base_and_punct<CharT, 16, true, UIntT>
                     ( ivalue, ifmt16, afmt, i.preview, lc, grp, thousands_sep, charset );
                 break;
             }
@@ -2262,7 +2328,7 @@ public:
                     grp = numpunct.grouping();
                     thousands_sep = numpunct.thousands_sep();
                 }
-                new ((void*)&storage_) int_printer_static_base_and_punct<CharT, 8, true>
+                new ((void*)&storage_) int_printer_static_base_and_punct<CharT, 8, true, UIntT>
                     ( ivalue, ifmt8, afmt, i.preview, lc, grp, thousands_sep, charset );
                 break;
             }
@@ -2274,7 +2340,7 @@ public:
                     grp = numpunct.grouping();
                     thousands_sep = numpunct.thousands_sep();
                 }
-                new ((void*)&storage_) int_printer_static_base_and_punct<CharT, 2, true>
+                new ((void*)&storage_) int_printer_static_base_and_punct<CharT, 2, true, UIntT>
                     ( ivalue, ifmt2, afmt, i.preview, lc, grp, thousands_sep, charset );
                 break;
             }
@@ -2286,7 +2352,7 @@ public:
                     grp = numpunct.grouping();
                     thousands_sep = numpunct.thousands_sep();
                 }
-                new ((void*)&storage_) int_printer_static_base_and_punct<CharT, 10, true>
+                new ((void*)&storage_) int_printer_static_base_and_punct<CharT, 10, true, UIntT>
                     ( ivalue, ifmt10, afmt, i.preview, lc, grp, thousands_sep, charset );
                 break;
             }
@@ -2315,11 +2381,20 @@ public:
 
 private:
 
-    static constexpr std::size_t pool_size_ =
-        sizeof(strf::detail::int_printer_static_base_and_punct<CharT, 10, true>);
+    template <int Base>
+    using printer_type_ = strf::detail::int_printer_static_base_and_punct<CharT, Base, true, UIntT>;
+
+    static constexpr std::size_t pool_size_ = strf::detail::max
+        ( strf::detail::max(sizeof(printer_type_<2>), sizeof(printer_type_<8>))
+        , strf::detail::max(sizeof(printer_type_<10>), sizeof(printer_type_<16>)) );
+
+    // may be greater than alignof(strf::printer<CharT>) when UIntT is a 128-bit integer
+    static constexpr std::size_t pool_alignment_ = strf::detail::max
+        ( strf::detail::max(alignof(printer_type_<2>), alignof(printer_type_<8>))
+        , strf::detail::max(alignof(printer_type_<10>), alignof(printer_type_<16>)) );
 
     using storage_type_ = typename std::aligned_storage
-        < pool_size_, alignof(strf::printer<CharT>)>
+        < pool_size_, pool_alignment_ >
         :: type;
 
     storage_type_ storage_;
@@ -2329,56 +2404,112 @@ private:
 
 STRF_EXPLICIT_TEMPLATE
 STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data<2>
-    ( fmt_int_printer_data& data
+    ( fmt_int_printer_data<unsigned long long>& data
+    , strf::int_format_static_base_and_punct<2, false> ifmt
+    , strf::alignment_format afmt ) noexcept;
+
+STRF_EXPLICIT_TEMPLATE
+STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data<8>
+    ( fmt_int_printer_data<unsigned long long>& data
+    , strf::int_format_static_base_and_punct<8, false> ifmt
+    , strf::alignment_format afmt ) noexcept;
+
+STRF_EXPLICIT_TEMPLATE
+STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data<10>
+    ( fmt_int_printer_data<unsigned long long>& data
+    , strf::int_format_static_base_and_punct<10, false> ifmt
+    , strf::alignment_format afmt ) noexcept;
+
+STRF_EXPLICIT_TEMPLATE
+STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data<16>
+    ( fmt_int_printer_data<unsigned long long>& data
+    , strf::int_format_static_base_and_punct<16, false> ifmt
+    , strf::alignment_format afmt ) noexcept;
+
+STRF_EXPLICIT_TEMPLATE
+STRF_HD fmt_int_printer_data_init_result init_punct_fmt_int_printer_data<2>
+    ( punct_fmt_int_printer_data<unsigned long long>& data
+    , strf::validate_f validate
+    , strf::int_format_static_base_and_punct<2, true> ifmt
+    , strf::alignment_format afmt ) noexcept;
+
+STRF_EXPLICIT_TEMPLATE
+STRF_HD fmt_int_printer_data_init_result init_punct_fmt_int_printer_data<8>
+    ( punct_fmt_int_printer_data<unsigned long long>& data
+    , strf::validate_f validate
+    , strf::int_format_static_base_and_punct<8, true> ifmt
+    , strf::alignment_format afmt ) noexcept;
+
+STRF_EXPLICIT_TEMPLATE
+STRF_HD fmt_int_printer_data_init_result init_punct_fmt_int_printer_data<10>
+    ( punct_fmt_int_printer_data<unsigned long long>& data
+    , strf::validate_f validate
+    , strf::int_format_static_base_and_punct<10, true> ifmt
+    , strf::alignment_format afmt ) noexcept;
+
+STRF_EXPLICIT_TEMPLATE
+STRF_HD fmt_int_printer_data_init_result init_punct_fmt_int_printer_data<16>
+    ( punct_fmt_int_printer_data<unsigned long long>& data
+    , strf::validate_f validate
+    , strf::int_format_static_base_and_punct<16, true> ifmt
+    , strf::alignment_format afmt ) noexcept;
+
+#if defined(STRF_HAS_INT128)
+
+STRF_EXPLICIT_TEMPLATE
+STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data<2>
+    ( fmt_int_printer_data<strf::detail::uint128_t>& data
     , strf::int_format_static_base_and_punct<2, false> ifmt
     , strf::alignment_format afmt ) noexcept;
 
 STRF_EXPLICIT_TEMPLATE
 STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data<8>
-    ( fmt_int_printer_data& data
+    ( fmt_int_printer_data<strf::detail::uint128_t>& data
     , strf::int_format_static_base_and_punct<8, false> ifmt
     , strf::alignment_format afmt ) noexcept;
 
 STRF_EXPLICIT_TEMPLATE
 STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data<10>
-    ( fmt_int_printer_data& data
+    ( fmt_int_printer_data<strf::detail::uint128_t>& data
     , strf::int_format_static_base_and_punct<10, false> ifmt
     , strf::alignment_format afmt ) noexcept;
 
 STRF_EXPLICIT_TEMPLATE
 STRF_HD fmt_int_printer_data_init_result init_fmt_int_printer_data<16>
-    ( fmt_int_printer_data& data
+    ( fmt_int_printer_data<strf::detail::uint128_t>& data
     , strf::int_format_static_base_and_punct<16, false> ifmt
     , strf::alignment_format afmt ) noexcept;
 
 STRF_EXPLICIT_TEMPLATE
 STRF_HD fmt_int_printer_data_init_result init_punct_fmt_int_printer_data<2>
-    ( punct_fmt_int_printer_data& data
+    ( punct_fmt_int_printer_data<strf::detail::uint128_t>& data
     , strf::validate_f validate
     , strf::int_format_static_base_and_punct<2, true> ifmt
     , strf::alignment_format afmt ) noexcept;
 
 STRF_EXPLICIT_TEMPLATE
 STRF_HD fmt_int_printer_data_init_result init_punct_fmt_int_printer_data<8>
-    ( punct_fmt_int_printer_data& data
+    ( punct_fmt_int_printer_data<strf::detail::uint128_t>& data
     , strf::validate_f validate
     , strf::int_format_static_base_and_punct<8, true> ifmt
     , strf::alignment_format afmt ) noexcept;
 
 STRF_EXPLICIT_TEMPLATE
 STRF_HD fmt_int_printer_data_init_result init_punct_fmt_int_printer_data<10>
-    ( punct_fmt_int_printer_data& data
+    ( punct_fmt_int_printer_data<strf::detail::uint128_t>& data
     , strf::validate_f validate
     , strf::int_format_static_base_and_punct<10, true> ifmt
     , strf::alignment_format afmt ) noexcept;
 
 STRF_EXPLICIT_TEMPLATE
 STRF_HD fmt_int_printer_data_init_result init_punct_fmt_int_printer_data<16>
-    ( punct_fmt_int_printer_data& data
+    ( punct_fmt_int_printer_data<strf::detail::uint128_t>& data
     , strf::validate_f validate
     , strf::int_format_static_base_and_punct<16, true> ifmt
     , strf::alignment_format afmt ) noexcept;
 
+#endif // defined(STRF_HAS_INT128)
+
 #if defined(__cpp_char8_t)
 STRF_EXPLICIT_TEMPLATE class default_int_printer<char8_t>;
 STRF_EXPLICIT_TEMPLATE class aligned_default_int_printer<char8_t>;
@@ -2446,6 +2577,10 @@ template <> struct is_int_number<unsigned short>: public std::true_type {};
 template <> struct is_int_number<unsigned int>: public std::true_type {};
 template <> struct is_int_number<unsigned long>: public std::true_type {};
 template <> struct is_int_number<unsigned long long>: public std::true_type {};
+#if defined(STRF_HAS_INT128)
+template <> struct is_int_number<strf::detail::int128_t>: public std::true_type {};
+template <> struct is_int_number<strf::detail::uint128_t>: public std::true_type {};
+#endif
 
 } // namespace strf
 
@@ -0,0 +1,944 @@
+#ifndef STRF_DETAIL_SIMD_HPP
+#define STRF_DETAIL_SIMD_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <strf/detail/strf_def.hpp>
+#include <cstdint>
+#include <cstring>
+
+// SIMD kernels are only used in host code. They can be disabled by
+// defining STRF_NO_SIMD. SSE2 and NEON are used when they are enabled
+// at compile-time. AVX2 is selected at run-time ( on GCC and Clang ),
+// or at compile-time when __AVX2__ is defined.
+
+#if ! defined(STRF_NO_SIMD) && ! defined(__CUDACC__)
+
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define STRF_HAS_SSE2
+#    if defined(__AVX2__)
+#      define STRF_HAS_AVX2
+#    elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#      define STRF_HAS_AVX2
+#      define STRF_AVX2_RUNTIME_DISPATCH
+#    endif
+#  elif defined(__aarch64__) && defined(__ARM_NEON)
+#    define STRF_HAS_NEON
+#  endif
+
+#  if defined(STRF_HAS_SSE2) || defined(STRF_HAS_NEON)
+#    define STRF_HAS_SIMD
+#  endif
+
+#endif // ! defined(STRF_NO_SIMD) && ! defined(__CUDACC__)
+
+#if defined(STRF_HAS_AVX2)
+#  include <immintrin.h>
+#elif defined(STRF_HAS_SSE2)
+#  include <emmintrin.h>
+#elif defined(STRF_HAS_NEON)
+#  include <arm_neon.h>
+#endif
+
+#if defined(STRF_AVX2_RUNTIME_DISPATCH)
+#  define STRF_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#  define STRF_TARGET_AVX2
+#endif
+
+#if defined(STRF_HAS_SIMD)
+
+namespace strf {
+namespace detail {
+namespace simd {
+
+inline int count_trailing_zeros(unsigned x) noexcept
+{
+    STRF_ASSERT(x != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(x);
+#else
+    int n = 0;
+    for (; (x & 1) == 0; x >>= 1) {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+#if defined(STRF_HAS_AVX2)
+
+inline bool cpu_has_avx2() noexcept
+{
+#if defined(STRF_AVX2_RUNTIME_DISPATCH)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    return true;
+#endif
+}
+
+#endif // defined(STRF_HAS_AVX2)
+
+// Scalar loop that completes the work of the vectorized kernels below
+
+template <typename DestCharT>
+inline std::size_t widen_ascii_tail
+    ( const std::uint8_t* src
+    , std::size_t i
+    , std::size_t count
+    , DestCharT* dest ) noexcept
+{
+    for (; i < count && src[i] < 0x80; ++i) {
+        dest[i] = static_cast<DestCharT>(src[i]);
+    }
+    return i;
+}
+
+#if defined(STRF_HAS_SSE2)
+
+inline void store_widened_ascii
+    ( std::integral_constant<std::size_t, 2>, void* dest, __m128i v ) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+    auto* d = static_cast<__m128i*>(dest);
+    _mm_storeu_si128(d,     _mm_unpacklo_epi8(v, zero));
+    _mm_storeu_si128(d + 1, _mm_unpackhi_epi8(v, zero));
+}
+
+inline void store_widened_ascii
+    ( std::integral_constant<std::size_t, 4>, void* dest, __m128i v ) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = _mm_unpacklo_epi8(v, zero);
+    const __m128i hi = _mm_unpackhi_epi8(v, zero);
+    auto* d = static_cast<__m128i*>(dest);
+    _mm_storeu_si128(d,     _mm_unpacklo_epi16(lo, zero));
+    _mm_storeu_si128(d + 1, _mm_unpackhi_epi16(lo, zero));
+    _mm_storeu_si128(d + 2, _mm_unpacklo_epi16(hi, zero));
+    _mm_storeu_si128(d + 3, _mm_unpackhi_epi16(hi, zero));
+}
+
+template <typename DestCharT>
+inline std::size_t widen_ascii_sse2
+    ( const std::uint8_t* src, std::size_t count, DestCharT* dest ) noexcept
+{
+    using char_size = std::integral_constant<std::size_t, sizeof(DestCharT)>;
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+        store_widened_ascii(char_size(), dest + i, v);
+    }
+    return widen_ascii_tail(src, i, count, dest);
+}
+
+#endif // defined(STRF_HAS_SSE2)
+
+#if defined(STRF_HAS_AVX2)
+
+STRF_TARGET_AVX2 inline void store_widened_ascii_avx2
+    ( std::integral_constant<std::size_t, 2>, void* dest, __m256i v ) noexcept
+{
+    auto* d = static_cast<__m256i*>(dest);
+    _mm256_storeu_si256(d,     _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+    _mm256_storeu_si256(d + 1, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+}
+
+STRF_TARGET_AVX2 inline void store_widened_ascii_avx2
+    ( std::integral_constant<std::size_t, 4>, void* dest, __m256i v ) noexcept
+{
+    const __m128i lo = _mm256_castsi256_si128(v);
+    const __m128i hi = _mm256_extracti128_si256(v, 1);
+    auto* d = static_cast<__m256i*>(dest);
+    _mm256_storeu_si256(d,     _mm256_cvtepu8_epi32(lo));
+    _mm256_storeu_si256(d + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+    _mm256_storeu_si256(d + 2, _mm256_cvtepu8_epi32(hi));
+    _mm256_storeu_si256(d + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+}
+
+template <typename DestCharT>
+STRF_TARGET_AVX2 inline std::size_t widen_ascii_avx2
+    ( const std::uint8_t* src, std::size_t count, DestCharT* dest ) noexcept
+{
+    using char_size = std::integral_constant<std::size_t, sizeof(DestCharT)>;
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        if (_mm256_movemask_epi8(v) != 0) {
+            break;
+        }
+        store_widened_ascii_avx2(char_size(), dest + i, v);
+    }
+    return widen_ascii_tail(src, i, count, dest);
+}
+
+#endif // defined(STRF_HAS_AVX2)
+
+#if defined(STRF_HAS_NEON)
+
+template <typename DestCharT>
+inline std::size_t widen_ascii_neon
+    ( const std::uint8_t* src, std::size_t count, DestCharT* dest ) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const uint8x16_t v = vld1q_u8(src + i);
+        if (vmaxvq_u8(v) >= 0x80) {
+            break;
+        }
+        const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+        const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+        STRF_IF_CONSTEXPR (sizeof(DestCharT) == 2) {
+            auto* d = reinterpret_cast<std::uint16_t*>(dest + i);
+            vst1q_u16(d,     lo);
+            vst1q_u16(d + 8, hi);
+        } else {
+            auto* d = reinterpret_cast<std::uint32_t*>(dest + i);
+            vst1q_u32(d,      vmovl_u16(vget_low_u16(lo)));
+            vst1q_u32(d + 4,  vmovl_u16(vget_high_u16(lo)));
+            vst1q_u32(d + 8,  vmovl_u16(vget_low_u16(hi)));
+            vst1q_u32(d + 12, vmovl_u16(vget_high_u16(hi)));
+        }
+    }
+    return widen_ascii_tail(src, i, count, dest);
+}
+
+#endif // defined(STRF_HAS_NEON)
+
+template <typename DestCharT>
+using widen_ascii_f = std::size_t (*)
+    ( const std::uint8_t* src, std::size_t count, DestCharT* dest );
+
+template <typename DestCharT>
+inline widen_ascii_f<DestCharT> select_widen_ascii() noexcept
+{
+#if defined(STRF_HAS_AVX2)
+    if (cpu_has_avx2()) {
+        return widen_ascii_avx2<DestCharT>;
+    }
+#endif
+#if defined(STRF_HAS_SSE2)
+    return widen_ascii_sse2<DestCharT>;
+#else
+    return widen_ascii_neon<DestCharT>;
+#endif
+}
+
+// Copies the longest prefix of `src` that contains only ASCII characters,
+// up to `count` code units, converting each one to DestCharT,
+// which is expected to be a 2 or 4 bytes character type.
+// Returns the number of code units copied.
+template <typename DestCharT>
+inline std::size_t widen_ascii
+    ( const std::uint8_t* src, std::size_t count, DestCharT* dest ) noexcept
+{
+    static_assert(sizeof(DestCharT) == 2 || sizeof(DestCharT) == 4, "");
+    static const widen_ascii_f<DestCharT> func = select_widen_ascii<DestCharT>();
+    return func(src, count, dest);
+}
+
+// Minimum input size to worth calling the SIMD kernels
+constexpr std::size_t min_simd_input_size = 16;
+
+// Whether the first 8 bytes are ASCII. This scalar test is done before
+// calling widen_ascii, so that the kernels are not called for short
+// runs of ASCII characters, like the spaces between non-latin words.
+inline bool starts_with_ascii_run(const std::uint8_t* src) noexcept
+{
+    std::uint64_t x;
+    std::memcpy(&x, src, sizeof(x));
+    return (x & 0x8080808080808080ull) == 0;
+}
+
+inline std::size_t narrow_ascii_tail
+    ( const std::uint32_t* src
+    , std::size_t i
+    , std::size_t count
+    , std::uint8_t* dest ) noexcept
+{
+    for (; i < count && src[i] < 0x80; ++i) {
+        dest[i] = static_cast<std::uint8_t>(src[i]);
+    }
+    return i;
+}
+
+#if defined(STRF_HAS_SSE2)
+
+inline std::size_t narrow_ascii_sse2
+    ( const std::uint32_t* src, std::size_t count, std::uint8_t* dest ) noexcept
+{
+    const __m128i non_ascii = _mm_set1_epi32(~0x7F);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const auto* s = reinterpret_cast<const __m128i*>(src + i);
+        const __m128i a = _mm_loadu_si128(s);
+        const __m128i b = _mm_loadu_si128(s + 1);
+        const __m128i c = _mm_loadu_si128(s + 2);
+        const __m128i d = _mm_loadu_si128(s + 3);
+        const __m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        const __m128i zero = _mm_setzero_si128();
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(all, non_ascii), zero)) != 0xFFFF) {
+            break;
+        }
+        const __m128i ab = _mm_packs_epi32(a, b);
+        const __m128i cd = _mm_packs_epi32(c, d);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_packus_epi16(ab, cd));
+    }
+    return narrow_ascii_tail(src, i, count, dest);
+}
+
+#endif // defined(STRF_HAS_SSE2)
+
+#if defined(STRF_HAS_AVX2)
+
+STRF_TARGET_AVX2 inline std::size_t narrow_ascii_avx2
+    ( const std::uint32_t* src, std::size_t count, std::uint8_t* dest ) noexcept
+{
+    const __m256i non_ascii = _mm256_set1_epi32(~0x7F);
+    // The packs instructions operate on each 128-bit lane separately
+    const __m256i reorder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        const auto* s = reinterpret_cast<const __m256i*>(src + i);
+        const __m256i a = _mm256_loadu_si256(s);
+        const __m256i b = _mm256_loadu_si256(s + 1);
+        const __m256i c = _mm256_loadu_si256(s + 2);
+        const __m256i d = _mm256_loadu_si256(s + 3);
+        const __m256i all = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+        if (! _mm256_testz_si256(all, non_ascii)) {
+            break;
+        }
+        const __m256i ab = _mm256_packs_epi32(a, b);
+        const __m256i cd = _mm256_packs_epi32(c, d);
+        const __m256i abcd = _mm256_packus_epi16(ab, cd);
+        _mm256_storeu_si256
+            ( reinterpret_cast<__m256i*>(dest + i)
+            , _mm256_permutevar8x32_epi32(abcd, reorder) );
+    }
+    return narrow_ascii_tail(src, i, count, dest);
+}
+
+#endif // defined(STRF_HAS_AVX2)
+
+#if defined(STRF_HAS_NEON)
+
+inline std::size_t narrow_ascii_neon
+    ( const std::uint32_t* src, std::size_t count, std::uint8_t* dest ) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const uint32x4_t a = vld1q_u32(src + i);
+        const uint32x4_t b = vld1q_u32(src + i + 4);
+        const uint32x4_t c = vld1q_u32(src + i + 8);
+        const uint32x4_t d = vld1q_u32(src + i + 12);
+        if (vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))) >= 0x80) {
+            break;
+        }
+        const uint16x8_t ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+        const uint16x8_t cd = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+        vst1q_u8(dest + i, vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)));
+    }
+    return narrow_ascii_tail(src, i, count, dest);
+}
+
+#endif // defined(STRF_HAS_NEON)
+
+using narrow_ascii_f = std::size_t (*)
+    ( const std::uint32_t* src, std::size_t count, std::uint8_t* dest );
+
+inline narrow_ascii_f select_narrow_ascii() noexcept
+{
+#if defined(STRF_HAS_AVX2)
+    if (cpu_has_avx2()) {
+        return narrow_ascii_avx2;
+    }
+#endif
+#if defined(STRF_HAS_SSE2)
+    return narrow_ascii_sse2;
+#else
+    return narrow_ascii_neon;
+#endif
+}
+
+// Copies the longest prefix of `src` that contains only code points
+// lower than 0x80, up to `count` code points, converting each one
+// to a single byte. Returns the number of code points copied.
+inline std::size_t narrow_ascii
+    ( const std::uint32_t* src, std::size_t count, std::uint8_t* dest ) noexcept
+{
+    static const narrow_ascii_f func = select_narrow_ascii();
+    return func(src, count, dest);
+}
+
+template <typename UIntT>
+inline std::size_t printable_ascii_prefix_tail
+    ( const UIntT* src, std::size_t i, std::size_t count ) noexcept
+{
+    for (; i < count && static_cast<UIntT>(src[i] - 0x20) < 0x5F; ++i) {
+    }
+    return i;
+}
+
+#if defined(STRF_HAS_SSE2)
+
+// Sets all the bits of the lanes that contain a value
+// from 0x20 to 0x7E. The signed comparisons reject the
+// values whose highest bit is set.
+
+inline __m128i printable_ascii_mask_sse2(const std::uint8_t*, __m128i v) noexcept
+{
+    return _mm_and_si128( _mm_cmpgt_epi8(v, _mm_set1_epi8(0x1F))
+                        , _mm_cmpgt_epi8(_mm_set1_epi8(0x7F), v) );
+}
+
+inline __m128i printable_ascii_mask_sse2(const std::uint16_t*, __m128i v) noexcept
+{
+    return _mm_and_si128( _mm_cmpgt_epi16(v, _mm_set1_epi16(0x1F))
+                        , _mm_cmpgt_epi16(_mm_set1_epi16(0x7F), v) );
+}
+
+inline __m128i printable_ascii_mask_sse2(const std::uint32_t*, __m128i v) noexcept
+{
+    return _mm_and_si128( _mm_cmpgt_epi32(v, _mm_set1_epi32(0x1F))
+                        , _mm_cmpgt_epi32(_mm_set1_epi32(0x7F), v) );
+}
+
+template <typename UIntT>
+inline std::size_t printable_ascii_prefix_sse2(const UIntT* src, std::size_t count) noexcept
+{
+    constexpr std::size_t step = 16 / sizeof(UIntT);
+    std::size_t i = 0;
+    for (; i + step <= count; i += step) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const auto mask = static_cast<unsigned>
+            (_mm_movemask_epi8(printable_ascii_mask_sse2(src, v)));
+        if (mask != 0xFFFF) {
+            return i + static_cast<std::size_t>(count_trailing_zeros(~mask)) / sizeof(UIntT);
+        }
+    }
+    return printable_ascii_prefix_tail(src, i, count);
+}
+
+#endif // defined(STRF_HAS_SSE2)
+
+#if defined(STRF_HAS_AVX2)
+
+STRF_TARGET_AVX2 inline __m256i printable_ascii_mask_avx2(const std::uint8_t*, __m256i v) noexcept
+{
+    return _mm256_and_si256( _mm256_cmpgt_epi8(v, _mm256_set1_epi8(0x1F))
+                           , _mm256_cmpgt_epi8(_mm256_set1_epi8(0x7F), v) );
+}
+
+STRF_TARGET_AVX2 inline __m256i printable_ascii_mask_avx2(const std::uint16_t*, __m256i v) noexcept
+{
+    return _mm256_and_si256( _mm256_cmpgt_epi16(v, _mm256_set1_epi16(0x1F))
+                           , _mm256_cmpgt_epi16(_mm256_set1_epi16(0x7F), v) );
+}
+
+STRF_TARGET_AVX2 inline __m256i printable_ascii_mask_avx2(const std::uint32_t*, __m256i v) noexcept
+{
+    return _mm256_and_si256( _mm256_cmpgt_epi32(v, _mm256_set1_epi32(0x1F))
+                           , _mm256_cmpgt_epi32(_mm256_set1_epi32(0x7F), v) );
+}
+
+template <typename UIntT>
+STRF_TARGET_AVX2 inline std::size_t printable_ascii_prefix_avx2
+    ( const UIntT* src, std::size_t count ) noexcept
+{
+    constexpr std::size_t step = 32 / sizeof(UIntT);
+    std::size_t i = 0;
+    for (; i + step <= count; i += step) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const auto mask = static_cast<unsigned>
+            (_mm256_movemask_epi8(printable_ascii_mask_avx2(src, v)));
+        if (mask != 0xFFFFFFFFu) {
+            return i + static_cast<std::size_t>(count_trailing_zeros(~mask)) / sizeof(UIntT);
+        }
+    }
+    return printable_ascii_prefix_tail(src, i, count);
+}
+
+#endif // defined(STRF_HAS_AVX2)
+
+#if defined(STRF_HAS_NEON)
+
+inline bool all_printable_ascii_neon(const std::uint8_t* src) noexcept
+{
+    const uint8x16_t v = vld1q_u8(src);
+    return vminvq_u8(vandq_u8(vcgeq_u8(v, vdupq_n_u8(0x20)), vcleq_u8(v, vdupq_n_u8(0x7E)))) != 0;
+}
+
+inline bool all_printable_ascii_neon(const std::uint16_t* src) noexcept
+{
+    const uint16x8_t v = vld1q_u16(src);
+    return vminvq_u16(vandq_u16(vcgeq_u16(v, vdupq_n_u16(0x20)), vcleq_u16(v, vdupq_n_u16(0x7E)))) != 0;
+}
+
+inline bool all_printable_ascii_neon(const std::uint32_t* src) noexcept
+{
+    const uint32x4_t v = vld1q_u32(src);
+    return vminvq_u32(vandq_u32(vcgeq_u32(v, vdupq_n_u32(0x20)), vcleq_u32(v, vdupq_n_u32(0x7E)))) != 0;
+}
+
+template <typename UIntT>
+inline std::size_t printable_ascii_prefix_neon(const UIntT* src, std::size_t count) noexcept
+{
+    constexpr std::size_t step = 16 / sizeof(UIntT);
+    std::size_t i = 0;
+    for (; i + step <= count && all_printable_ascii_neon(src + i); i += step) {
+    }
+    return printable_ascii_prefix_tail(src, i, count);
+}
+
+#endif // defined(STRF_HAS_NEON)
+
+template <typename UIntT>
+using printable_ascii_prefix_f = std::size_t (*)(const UIntT* src, std::size_t count);
+
+template <typename UIntT>
+inline printable_ascii_prefix_f<UIntT> select_printable_ascii_prefix() noexcept
+{
+#if defined(STRF_HAS_AVX2)
+    if (cpu_has_avx2()) {
+        return printable_ascii_prefix_avx2<UIntT>;
+    }
+#endif
+#if defined(STRF_HAS_SSE2)
+    return printable_ascii_prefix_sse2<UIntT>;
+#else
+    return printable_ascii_prefix_neon<UIntT>;
+#endif
+}
+
+// Returns the number of code units at the beginning of `src`,
+// up to `count`, whose values are from 0x20 to 0x7E.
+template <typename UIntT>
+inline std::size_t printable_ascii_prefix(const UIntT* src, std::size_t count) noexcept
+{
+    static const printable_ascii_prefix_f<UIntT> func = select_printable_ascii_prefix<UIntT>();
+    return func(src, count);
+}
+
+// Returns the position of the end of the last complete UTF-8 sequence
+// within `src[0, pos)`, assuming that it is all valid.
+inline std::size_t utf8_last_boundary(const std::uint8_t* src, std::size_t pos) noexcept
+{
+    for (std::size_t k = 1; k <= 3 && k <= pos; ++k) {
+        const std::uint8_t ch = src[pos - k];
+        if (ch < 0x80) {
+            return pos;
+        }
+        if (ch >= 0xC0) {
+            const std::size_t seq_size = ch < 0xE0 ? 2 : (ch < 0xF0 ? 3 : 4);
+            return k < seq_size ? pos - k : pos;
+        }
+    }
+    return pos;
+}
+
+// Lookup tables of the UTF-8 validation algorithm described by
+// John Keiser and Daniel Lemire in "Validating UTF-8 In Less Than
+// One Instruction Per Byte". Each byte and the previous one are
+// classified by three 16-entries tables, indexed by the high nibble
+// of the previous byte, the low nibble of the previous byte, and
+// the high nibble of the current byte. The bitwise AND of the three
+// results is non-zero when the pair is invalid.
+
+namespace utf8_err {
+
+constexpr std::uint8_t too_short      = 1 << 0; // lead byte followed by a non-continuation
+constexpr std::uint8_t too_long       = 1 << 1; // ASCII followed by a continuation
+constexpr std::uint8_t overlong_3     = 1 << 2;
+constexpr std::uint8_t too_large      = 1 << 3;
+constexpr std::uint8_t surrogate      = 1 << 4;
+constexpr std::uint8_t overlong_2     = 1 << 5;
+constexpr std::uint8_t too_large_1000 = 1 << 6;
+constexpr std::uint8_t overlong_4     = 1 << 6;
+constexpr std::uint8_t two_conts      = 1 << 7; // two continuations in a row
+constexpr std::uint8_t carry = too_short | too_long | two_conts;
+
+} // namespace utf8_err
+
+#define STRF_UTF8_BYTE_1_HIGH_TABLE                                           \
+    utf8_err::too_long, utf8_err::too_long, utf8_err::too_long,               \
+    utf8_err::too_long, utf8_err::too_long, utf8_err::too_long,               \
+    utf8_err::too_long, utf8_err::too_long,                                   \
+    utf8_err::two_conts, utf8_err::two_conts,                                 \
+    utf8_err::two_conts, utf8_err::two_conts,                                 \
+    utf8_err::too_short | utf8_err::overlong_2,                               \
+    utf8_err::too_short,                                                      \
+    utf8_err::too_short | utf8_err::overlong_3 | utf8_err::surrogate,         \
+    utf8_err::too_short | utf8_err::too_large | utf8_err::too_large_1000      \
+    | utf8_err::overlong_4
+
+#define STRF_UTF8_BYTE_1_LOW_TABLE                                            \
+    utf8_err::carry | utf8_err::overlong_3 | utf8_err::overlong_2             \
+    | utf8_err::overlong_4,                                                   \
+    utf8_err::carry | utf8_err::overlong_2,                                   \
+    utf8_err::carry,                                                          \
+    utf8_err::carry,                                                          \
+    utf8_err::carry | utf8_err::too_large,                                    \
+    utf8_err::carry | utf8_err::too_large | utf8_err::too_large_1000,         \
+    utf8_err::carry | utf8_err::too_large | utf8_err::too_large_1000,         \
+    utf8_err::carry | utf8_err::too_large | utf8_err::too_large_1000,         \
+    utf8_err::carry | utf8_err::too_large | utf8_err::too_large_1000,         \
+    utf8_err::carry | utf8_err::too_large | utf8_err::too_large_1000,         \
+    utf8_err::carry | utf8_err::too_large | utf8_err::too_large_1000,         \
+    utf8_err::carry | utf8_err::too_large | utf8_err::too_large_1000,         \
+    utf8_err::carry | utf8_err::too_large | utf8_err::too_large_1000,         \
+    utf8_err::carry | utf8_err::too_large | utf8_err::too_large_1000          \
+    | utf8_err::surrogate,                                                    \
+    utf8_err::carry | utf8_err::too_large | utf8_err::too_large_1000,         \
+    utf8_err::carry | utf8_err::too_large | utf8_err::too_large_1000
+
+#define STRF_UTF8_BYTE_2_HIGH_TABLE                                           \
+    utf8_err::too_short, utf8_err::too_short, utf8_err::too_short,            \
+    utf8_err::too_short, utf8_err::too_short, utf8_err::too_short,            \
+    utf8_err::too_short, utf8_err::too_short,                                 \
+    utf8_err::too_long | utf8_err::overlong_2 | utf8_err::two_conts           \
+    | utf8_err::overlong_3 | utf8_err::too_large_1000 | utf8_err::overlong_4, \
+    utf8_err::too_long | utf8_err::overlong_2 | utf8_err::two_conts           \
+    | utf8_err::overlong_3 | utf8_err::too_large,                             \
+    utf8_err::too_long | utf8_err::overlong_2 | utf8_err::two_conts           \
+    | utf8_err::surrogate | utf8_err::too_large,                              \
+    utf8_err::too_long | utf8_err::overlong_2 | utf8_err::two_conts           \
+    | utf8_err::surrogate | utf8_err::too_large,                              \
+    utf8_err::too_short, utf8_err::too_short,                                 \
+    utf8_err::too_short, utf8_err::too_short
+
+#if defined(STRF_HAS_AVX2)
+
+STRF_TARGET_AVX2 inline __m256i utf8_table_avx2
+    ( std::uint8_t t0, std::uint8_t t1, std::uint8_t t2, std::uint8_t t3
+    , std::uint8_t t4, std::uint8_t t5, std::uint8_t t6, std::uint8_t t7
+    , std::uint8_t t8, std::uint8_t t9, std::uint8_t t10, std::uint8_t t11
+    , std::uint8_t t12, std::uint8_t t13, std::uint8_t t14, std::uint8_t t15 ) noexcept
+{
+    return _mm256_setr_epi8
+        ( (char)t0, (char)t1, (char)t2, (char)t3, (char)t4, (char)t5, (char)t6, (char)t7
+        , (char)t8, (char)t9, (char)t10, (char)t11, (char)t12, (char)t13, (char)t14, (char)t15
+        , (char)t0, (char)t1, (char)t2, (char)t3, (char)t4, (char)t5, (char)t6, (char)t7
+        , (char)t8, (char)t9, (char)t10, (char)t11, (char)t12, (char)t13, (char)t14, (char)t15 );
+}
+
+STRF_TARGET_AVX2 inline __m256i utf8_high_nibbles_avx2(__m256i v) noexcept
+{
+    return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+}
+
+// Returns non-zero bytes where `input` is not a valid continuation
+// of `prev_input` ( the previous 32 bytes )
+STRF_TARGET_AVX2 inline __m256i utf8_block_errors_avx2(__m256i input, __m256i prev_input) noexcept
+{
+    const __m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    const __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+    const __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+    const __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+
+    const __m256i byte_1_high = _mm256_shuffle_epi8
+        ( utf8_table_avx2(STRF_UTF8_BYTE_1_HIGH_TABLE), utf8_high_nibbles_avx2(prev1) );
+    const __m256i byte_1_low = _mm256_shuffle_epi8
+        ( utf8_table_avx2(STRF_UTF8_BYTE_1_LOW_TABLE)
+        , _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)) );
+    const __m256i byte_2_high = _mm256_shuffle_epi8
+        ( utf8_table_avx2(STRF_UTF8_BYTE_2_HIGH_TABLE), utf8_high_nibbles_avx2(input) );
+    const __m256i special_cases = _mm256_and_si256
+        ( _mm256_and_si256(byte_1_high, byte_1_low), byte_2_high );
+
+    // Third and fourth bytes of a sequence must be continuations
+    const __m256i is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0u - 0x80));
+    const __m256i is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0u - 0x80));
+    const __m256i must23_80 = _mm256_and_si256
+        ( _mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8((char)0x80) );
+    return _mm256_xor_si256(must23_80, special_cases);
+}
+
+STRF_TARGET_AVX2 inline std::size_t utf8_valid_prefix_avx2
+    ( const std::uint8_t* src, std::size_t count ) noexcept
+{
+    __m256i prev_input = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        if ( _mm256_movemask_epi8(input) != 0 || _mm256_movemask_epi8(prev_input) != 0) {
+            const __m256i err = utf8_block_errors_avx2(input, prev_input);
+            if ( ! _mm256_testz_si256(err, err)) {
+                break;
+            }
+        }
+        prev_input = input;
+    }
+    return utf8_last_boundary(src, i);
+}
+
+#endif // defined(STRF_HAS_AVX2)
+
+#if defined(STRF_HAS_NEON)
+
+inline uint8x16_t utf8_table_neon
+    ( std::uint8_t t0, std::uint8_t t1, std::uint8_t t2, std::uint8_t t3
+    , std::uint8_t t4, std::uint8_t t5, std::uint8_t t6, std::uint8_t t7
+    , std::uint8_t t8, std::uint8_t t9, std::uint8_t t10, std::uint8_t t11
+    , std::uint8_t t12, std::uint8_t t13, std::uint8_t t14, std::uint8_t t15 ) noexcept
+{
+    const std::uint8_t table[16] =
+        { t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15 };
+    return vld1q_u8(table);
+}
+
+// Returns non-zero bytes where `input` is not a valid continuation
+// of `prev_input` ( the previous 16 bytes )
+inline uint8x16_t utf8_block_errors_neon(uint8x16_t input, uint8x16_t prev_input) noexcept
+{
+    const uint8x16_t prev1 = vextq_u8(prev_input, input, 15);
+    const uint8x16_t prev2 = vextq_u8(prev_input, input, 14);
+    const uint8x16_t prev3 = vextq_u8(prev_input, input, 13);
+
+    const uint8x16_t byte_1_high = vqtbl1q_u8
+        ( utf8_table_neon(STRF_UTF8_BYTE_1_HIGH_TABLE), vshrq_n_u8(prev1, 4) );
+    const uint8x16_t byte_1_low = vqtbl1q_u8
+        ( utf8_table_neon(STRF_UTF8_BYTE_1_LOW_TABLE), vandq_u8(prev1, vdupq_n_u8(0x0F)) );
+    const uint8x16_t byte_2_high = vqtbl1q_u8
+        ( utf8_table_neon(STRF_UTF8_BYTE_2_HIGH_TABLE), vshrq_n_u8(input, 4) );
+    const uint8x16_t special_cases = vandq_u8(vandq_u8(byte_1_high, byte_1_low), byte_2_high);
+
+    const uint8x16_t is_third_byte = vqsubq_u8(prev2, vdupq_n_u8(0xE0u - 0x80));
+    const uint8x16_t is_fourth_byte = vqsubq_u8(prev3, vdupq_n_u8(0xF0u - 0x80));
+    const uint8x16_t must23_80 = vandq_u8
+        ( vorrq_u8(is_third_byte, is_fourth_byte), vdupq_n_u8(0x80) );
+    return veorq_u8(must23_80, special_cases);
+}
+
+inline std::size_t utf8_valid_prefix_neon
+    ( const std::uint8_t* src, std::size_t count ) noexcept
+{
+    uint8x16_t prev_input = vdupq_n_u8(0);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const uint8x16_t input = vld1q_u8(src + i);
+        if (vmaxvq_u8(vorrq_u8(input, prev_input)) >= 0x80) {
+            if (vmaxvq_u8(utf8_block_errors_neon(input, prev_input)) != 0) {
+                break;
+            }
+        }
+        prev_input = input;
+    }
+    return utf8_last_boundary(src, i);
+}
+
+#endif // defined(STRF_HAS_NEON)
+
+#if defined(STRF_HAS_SSE2)
+
+// Without SSSE3 there is no byte shuffle to perform the table lookups,
+// so this kernel only skips blocks of ASCII characters.
+inline std::size_t utf8_valid_prefix_sse2
+    ( const std::uint8_t* src, std::size_t count ) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const int mask = _mm_movemask_epi8(v);
+        if (mask != 0) {
+            return i + static_cast<std::size_t>(count_trailing_zeros(static_cast<unsigned>(mask)));
+        }
+    }
+    return i;
+}
+
+#endif // defined(STRF_HAS_SSE2)
+
+#undef STRF_UTF8_BYTE_1_HIGH_TABLE
+#undef STRF_UTF8_BYTE_1_LOW_TABLE
+#undef STRF_UTF8_BYTE_2_HIGH_TABLE
+
+using utf8_valid_prefix_f = std::size_t (*)(const std::uint8_t* src, std::size_t count);
+
+inline utf8_valid_prefix_f select_utf8_valid_prefix() noexcept
+{
+#if defined(STRF_HAS_AVX2)
+    if (cpu_has_avx2()) {
+        return utf8_valid_prefix_avx2;
+    }
+#endif
+#if defined(STRF_HAS_SSE2)
+    return utf8_valid_prefix_sse2;
+#else
+    return utf8_valid_prefix_neon;
+#endif
+}
+
+// Returns the size of a prefix of `src[0, count)` that is made only
+// of complete and valid UTF-8 sequences ( surrogates are considered
+// invalid ). It is not necessarily the longest one: the input is
+// verified in blocks, and the scan stops at the first block that
+// contains an invalid or suspicious sequence.
+inline std::size_t utf8_valid_prefix(const std::uint8_t* src, std::size_t count) noexcept
+{
+    static const utf8_valid_prefix_f func = select_utf8_valid_prefix();
+    return func(src, count);
+}
+
+// Minimum input size to worth calling utf8_valid_prefix
+constexpr std::size_t min_utf8_validation_size = 64;
+
+// `letters_offset` is the value added to the digits greater than 9
+// besides '0': ( 'a' - '0' - 10 ) for lowercase and ( 'A' - '0' - 10 )
+// for uppercase.
+
+inline void hex_encode_tail
+    ( const std::uint8_t* src
+    , std::size_t i
+    , std::size_t count
+    , std::uint8_t* dest
+    , std::uint8_t letters_offset ) noexcept
+{
+    for (; i < count; ++i) {
+        const unsigned hi = src[i] >> 4;
+        const unsigned lo = src[i] & 0xF;
+        dest[2 * i]     = static_cast<std::uint8_t>('0' + hi + (hi > 9 ? letters_offset : 0u));
+        dest[2 * i + 1] = static_cast<std::uint8_t>('0' + lo + (lo > 9 ? letters_offset : 0u));
+    }
+}
+
+#if defined(STRF_HAS_SSE2)
+
+inline __m128i hex_digits_to_ascii_sse2(__m128i digits, __m128i letters_offset) noexcept
+{
+    const __m128i is_letter = _mm_cmpgt_epi8(digits, _mm_set1_epi8(9));
+    const __m128i offset = _mm_add_epi8
+        ( _mm_set1_epi8('0'), _mm_and_si128(is_letter, letters_offset) );
+    return _mm_add_epi8(digits, offset);
+}
+
+inline void hex_encode_sse2
+    ( const std::uint8_t* src
+    , std::size_t count
+    , std::uint8_t* dest
+    , std::uint8_t letters_offset ) noexcept
+{
+    const __m128i low_nibbles = _mm_set1_epi8(0xF);
+    const __m128i offset = _mm_set1_epi8(static_cast<char>(letters_offset));
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), low_nibbles);
+        const __m128i lo = _mm_and_si128(v, low_nibbles);
+        auto* d = reinterpret_cast<__m128i*>(dest + 2 * i);
+        _mm_storeu_si128(d,     hex_digits_to_ascii_sse2(_mm_unpacklo_epi8(hi, lo), offset));
+        _mm_storeu_si128(d + 1, hex_digits_to_ascii_sse2(_mm_unpackhi_epi8(hi, lo), offset));
+    }
+    hex_encode_tail(src, i, count, dest, letters_offset);
+}
+
+#endif // defined(STRF_HAS_SSE2)
+
+#if defined(STRF_HAS_AVX2)
+
+STRF_TARGET_AVX2 inline __m256i hex_digits_to_ascii_avx2
+    ( __m256i digits, __m256i letters_offset ) noexcept
+{
+    const __m256i is_letter = _mm256_cmpgt_epi8(digits, _mm256_set1_epi8(9));
+    const __m256i offset = _mm256_add_epi8
+        ( _mm256_set1_epi8('0'), _mm256_and_si256(is_letter, letters_offset) );
+    return _mm256_add_epi8(digits, offset);
+}
+
+STRF_TARGET_AVX2 inline void hex_encode_avx2
+    ( const std::uint8_t* src
+    , std::size_t count
+    , std::uint8_t* dest
+    , std::uint8_t letters_offset ) noexcept
+{
+    const __m256i low_nibbles = _mm256_set1_epi8(0xF);
+    const __m256i offset = _mm256_set1_epi8(static_cast<char>(letters_offset));
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_nibbles);
+        const __m256i lo = _mm256_and_si256(v, low_nibbles);
+        // The unpack instructions operate on each 128-bit lane separately
+        const __m256i a = hex_digits_to_ascii_avx2(_mm256_unpacklo_epi8(hi, lo), offset);
+        const __m256i b = hex_digits_to_ascii_avx2(_mm256_unpackhi_epi8(hi, lo), offset);
+        auto* d = reinterpret_cast<__m256i*>(dest + 2 * i);
+        _mm256_storeu_si256(d,     _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256(d + 1, _mm256_permute2x128_si256(a, b, 0x31));
+    }
+    hex_encode_tail(src, i, count, dest, letters_offset);
+}
+
+#endif // defined(STRF_HAS_AVX2)
+
+#if defined(STRF_HAS_NEON)
+
+inline uint8x16_t hex_digits_to_ascii_neon(uint8x16_t digits, uint8x16_t letters_offset) noexcept
+{
+    const uint8x16_t is_letter = vcgtq_u8(digits, vdupq_n_u8(9));
+    const uint8x16_t offset = vaddq_u8(vdupq_n_u8('0'), vandq_u8(is_letter, letters_offset));
+    return vaddq_u8(digits, offset);
+}
+
+inline void hex_encode_neon
+    ( const std::uint8_t* src
+    , std::size_t count
+    , std::uint8_t* dest
+    , std::uint8_t letters_offset ) noexcept
+{
+    const uint8x16_t offset = vdupq_n_u8(letters_offset);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const uint8x16_t v = vld1q_u8(src + i);
+        uint8x16x2_t digits;
+        digits.val[0] = hex_digits_to_ascii_neon(vshrq_n_u8(v, 4), offset);
+        digits.val[1] = hex_digits_to_ascii_neon(vandq_u8(v, vdupq_n_u8(0xF)), offset);
+        vst2q_u8(dest + 2 * i, digits); // interleaves the two vectors
+    }
+    hex_encode_tail(src, i, count, dest, letters_offset);
+}
+
+#endif // defined(STRF_HAS_NEON)
+
+using hex_encode_f = void (*)
+    ( const std::uint8_t* src, std::size_t count
+    , std::uint8_t* dest, std::uint8_t letters_offset );
+
+inline hex_encode_f select_hex_encode() noexcept
+{
+#if defined(STRF_HAS_AVX2)
+    if (cpu_has_avx2()) {
+        return hex_encode_avx2;
+    }
+#endif
+#if defined(STRF_HAS_SSE2)
+    return hex_encode_sse2;
+#else
+    return hex_encode_neon;
+#endif
+}
+
+// Writes the two hexadecimal digits of each of the `count` bytes
+// of `src` into `dest`, the most significant one first.
+// `dest` must have room for ( 2 * count ) bytes.
+inline void hex_encode
+    ( const std::uint8_t* src
+    , std::size_t count
+    , std::uint8_t* dest
+    , std::uint8_t letters_offset ) noexcept
+{
+    static const hex_encode_f func = select_hex_encode();
+    func(src, count, dest, letters_offset);
+}
+
+} // namespace simd
+} // namespace detail
+} // namespace strf
+
+#endif // defined(STRF_HAS_SIMD)
+
+#endif  // STRF_DETAIL_SIMD_HPP
@@ -100,6 +100,26 @@ inline STRF_HD int countr_zero_ll(unsigned long long x) noexcept
 #  endif // __has_builtin(__builtin_ctzll)
 #endif
 
+#if defined(__cpp_lib_is_constant_evaluated)
+#  define STRF_HAS_IS_CONSTANT_EVALUATED
+
+constexpr STRF_HD bool is_constant_evaluated() noexcept
+{
+    return std::is_constant_evaluated();
+}
+
+#elif defined(__has_builtin)
+#  if __has_builtin(__builtin_is_constant_evaluated)
+#    define STRF_HAS_IS_CONSTANT_EVALUATED
+
+constexpr STRF_HD bool is_constant_evaluated() noexcept
+{
+    return __builtin_is_constant_evaluated();
+}
+
+#  endif // __has_builtin(__builtin_is_constant_evaluated)
+#endif
+
 #if defined(__cpp_lib_bit_cast)
 
 template< class To, class From >
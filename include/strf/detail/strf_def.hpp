@@ -70,6 +70,18 @@
 #  define STRF_HAS_VARIABLE_TEMPLATES
 #endif
 
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+#  define STRF_HAS_CLASS_TYPE_TEMPLATE_ARGS
+#endif
+
+// __int128 is only supported when the standard library type traits
+// ( std::is_integral, std::make_unsigned, etc ) recognize it, which
+// is not the case in the strict ISO modes ( -std=c++NN )
+#if defined(__SIZEOF_INT128__) && ! defined(__STRICT_ANSI__) \
+    && ! defined(__CUDACC__) && ! defined(STRF_NO_INT128)
+#  define STRF_HAS_INT128
+#endif
+
 #if defined(__CUDACC__)
 #  if (__CUDACC_VER_MAJOR__ >= 11)
 #    define STRF_HAS_ATTR_DEPRECATED
@@ -262,6 +274,11 @@ using conditional_t = typename std::conditional<B, TrueT, FalseT>::type;
 template <typename T>
 using make_signed_t = typename std::make_signed<T>::type;
 
+#if defined(STRF_HAS_INT128)
+__extension__ using int128_t = __int128;
+__extension__ using uint128_t = unsigned __int128;
+#endif
+
 template <std::size_t CharSize>
 struct wchar_equiv_impl;
 
@@ -8,6 +8,7 @@
 
 #include <strf/detail/facets/charset.hpp>
 #include <strf/detail/standard_lib_functions.hpp>
+#include <strf/detail/simd.hpp>
 
 namespace strf {
 
@@ -236,6 +237,145 @@ inline STRF_HD bool first_2_of_4_are_valid(std::uint8_t ch0, std::uint8_t ch1)
     return first_2_of_4_are_valid(utf8_decode_first_2_of_4(ch0, ch1));
 }
 
+// Decodes the code point that starts at `src`, which must not be
+// `src_end`, and moves `src` past it. If the sequence is invalid,
+// `ch32` is set to U+FFFD and false is returned.
+template <typename CharT>
+STRF_HD bool utf8_decode_next
+    ( const CharT*& src
+    , const CharT* src_end
+    , char32_t& ch32
+    , strf::surrogate_policy surr_poli ) noexcept
+{
+    std::uint8_t ch0, ch1, ch2, ch3;
+    unsigned long x;
+    ch0 = *src;
+    ++src;
+    if (ch0 < 0x80) {
+        ch32 = ch0;
+    } else if (0xC0 == (ch0 & 0xE0)) {
+        if(ch0 > 0xC1 && src != src_end && is_utf8_continuation(ch1 = *src)) {
+            ch32 = utf8_decode(ch0, ch1);
+            ++src;
+        } else goto invalid_sequence;
+    } else if (0xE0 == ch0) {
+        if (   src != src_end && (((ch1 = *src) & 0xE0) == 0xA0)
+          && ++src != src_end && is_utf8_continuation(ch2 = *src) )
+        {
+            ch32 = ((ch1 & 0x3F) << 6) | (ch2 & 0x3F);
+            ++src;
+        } else goto invalid_sequence;
+    } else if (0xE0 == (ch0 & 0xF0)) {
+        if (   src != src_end && is_utf8_continuation(ch1 = *src)
+          && first_2_of_3_are_valid( x = utf8_decode_first_2_of_3(ch0, ch1)
+                                   , surr_poli )
+          && ++src != src_end && is_utf8_continuation(ch2 = *src) )
+        {
+            ch32 = static_cast<char32_t>((x << 6) | (ch2 & 0x3F));
+            ++src;
+        } else goto invalid_sequence;
+    } else if ( src != src_end
+             && is_utf8_continuation(ch1 = *src)
+             && first_2_of_4_are_valid(x = utf8_decode_first_2_of_4(ch0, ch1))
+             && ++src != src_end && is_utf8_continuation(ch2 = *src)
+             && ++src != src_end && is_utf8_continuation(ch3 = *src) )
+    {
+        ch32 = utf8_decode_last_2_of_4(x, ch2, ch3);
+        ++src;
+    } else {
+        invalid_sequence:
+        ch32 = 0xFFFD;
+        return false;
+    }
+    return true;
+}
+
+// The functions below decode the code points from `src` into `dest`
+// until either `src_end` or `dest_end` is reached, replacing each
+// invalid sequence by U+FFFD, just like the corresponding to_u32()
+// transcoder. They return the end of the decoded input and advance `dest`.
+
+template <typename CharT>
+STRF_HD const CharT* utf8_decode_chunk
+    ( const CharT* src
+    , const CharT* src_end
+    , char32_t*& dest
+    , char32_t* dest_end
+    , strf::surrogate_policy surr_poli ) noexcept
+{
+    auto dest_it = dest;
+    while (src != src_end && dest_it != dest_end) {
+#if defined(STRF_HAS_SIMD)
+        STRF_IF_UNLIKELY ( static_cast<std::uint8_t>(*src) < 0x80
+                         && src_end - src >= (std::ptrdiff_t)strf::detail::simd::min_simd_input_size
+                         && strf::detail::simd::starts_with_ascii_run
+                             ( reinterpret_cast<const std::uint8_t*>(src) ) ) {
+            const auto count = strf::detail::min<std::size_t>(src_end - src, dest_end - dest_it);
+            const auto n = strf::detail::simd::widen_ascii
+                ( reinterpret_cast<const std::uint8_t*>(src), count, dest_it );
+            src += n;
+            dest_it += n;
+            continue;
+        }
+#endif // defined(STRF_HAS_SIMD)
+        utf8_decode_next(src, src_end, *dest_it, surr_poli);
+        ++dest_it;
+    }
+    dest = dest_it;
+    return src;
+}
+
+template <typename CharT>
+STRF_HD const CharT* utf16_decode_chunk
+    ( const CharT* src
+    , const CharT* src_end
+    , char32_t*& dest
+    , char32_t* dest_end
+    , strf::surrogate_policy surr_poli ) noexcept
+{
+    unsigned long ch, ch2;
+    auto dest_it = dest;
+    for (; src != src_end && dest_it != dest_end; ++dest_it) {
+        ch = *src;
+        ++src;
+        STRF_IF_LIKELY (strf::detail::not_surrogate(ch)) {
+            *dest_it = static_cast<char32_t>(ch);
+        } else if ( strf::detail::is_high_surrogate(ch)
+               && src != src_end
+               && strf::detail::is_low_surrogate(ch2 = *src)) {
+            *dest_it = static_cast<char32_t>(0x10000 + (((ch & 0x3FF) << 10) | (ch2 & 0x3FF)));
+            ++src;
+        } else if (surr_poli == strf::surrogate_policy::lax) {
+            *dest_it = static_cast<char32_t>(ch);
+        } else {
+            *dest_it = 0xFFFD;
+        }
+    }
+    dest = dest_it;
+    return src;
+}
+
+template <typename CharT>
+STRF_HD const CharT* utf32_decode_chunk
+    ( const CharT* src
+    , const CharT* src_end
+    , char32_t*& dest
+    , char32_t* dest_end
+    , strf::surrogate_policy surr_poli ) noexcept
+{
+    auto dest_it = dest;
+    const bool lax = surr_poli == strf::surrogate_policy::lax;
+    for (; src != src_end && dest_it != dest_end; ++src, ++dest_it) {
+        auto ch = static_cast<char32_t>(*src);
+        STRF_IF_UNLIKELY (ch >= 0x110000 || (! lax && strf::detail::is_surrogate(ch))) {
+            ch = 0xFFFD;
+        }
+        *dest_it = ch;
+    }
+    dest = dest_it;
+    return src;
+}
+
 } // namespace detail
 
 template <typename SrcCharT, typename DestCharT>
@@ -1021,67 +1161,34 @@ STRF_HD void strf::static_transcoder
     , strf::invalid_seq_notifier inv_seq_notifier
     , strf::surrogate_policy surr_poli )
 {
-    using strf::detail::utf8_decode;
-    using strf::detail::utf8_decode_first_2_of_3;
-    using strf::detail::utf8_decode_first_2_of_4;
-    using strf::detail::utf8_decode_last_2_of_4;
-    using strf::detail::first_2_of_3_are_valid;
-    using strf::detail::first_2_of_4_are_valid;
-    using strf::detail::is_utf8_continuation;
-
-    std::uint8_t ch0, ch1, ch2, ch3;
-    unsigned long x;
     auto src_it = src;
     auto src_end = src + src_size;
     auto dest_it = dest.buffer_ptr();
     auto dest_end = dest.buffer_end();
-    DestCharT ch32;
+    char32_t ch32;
 
     while(src_it != src_end) {
-        ch0 = (*src_it);
-        ++src_it;
-        if (ch0 < 0x80) {
-            ch32 = ch0;
-        } else if (0xC0 == (ch0 & 0xE0)) {
-            if(ch0 > 0xC1 && src_it != src_end && is_utf8_continuation(ch1 = * src_it)) {
-                ch32 = utf8_decode(ch0, ch1);
-                ++src_it;
-            } else goto invalid_sequence;
-        } else if (0xE0 == ch0) {
-            if (   src_it != src_end && (((ch1 = * src_it) & 0xE0) == 0xA0)
-              && ++src_it != src_end && is_utf8_continuation(ch2 = * src_it) )
-            {
-                ch32 = ((ch1 & 0x3F) << 6) | (ch2 & 0x3F);
-                ++src_it;
-            } else goto invalid_sequence;
-        } else if (0xE0 == (ch0 & 0xF0)) {
-            if (   src_it != src_end && is_utf8_continuation(ch1 = * src_it)
-              && first_2_of_3_are_valid( x = utf8_decode_first_2_of_3(ch0, ch1)
-                                       , surr_poli )
-              && ++src_it != src_end && is_utf8_continuation(ch2 = * src_it) )
-            {
-                ch32 = (x << 6) | (ch2 & 0x3F);
-                ++src_it;
-            } else goto invalid_sequence;
-        } else if ( src_it != src_end
-                 && is_utf8_continuation(ch1 = * src_it)
-                 && first_2_of_4_are_valid(x = utf8_decode_first_2_of_4(ch0, ch1))
-                 && ++src_it != src_end && is_utf8_continuation(ch2 = * src_it)
-                 && ++src_it != src_end && is_utf8_continuation(ch3 = * src_it) )
-        {
-            ch32 = utf8_decode_last_2_of_4(x, ch2, ch3);
-            ++src_it;
-        } else {
-            invalid_sequence:
-            ch32 = 0xFFFD;
-            if (inv_seq_notifier) {
-                dest.advance_to(dest_it);
-                inv_seq_notifier.notify();
-            }
+#if defined(STRF_HAS_SIMD)
+        STRF_IF_UNLIKELY ( static_cast<std::uint8_t>(*src_it) < 0x80
+                         && src_end - src_it >= (std::ptrdiff_t)strf::detail::simd::min_simd_input_size
+                         && strf::detail::simd::starts_with_ascii_run
+                             ( reinterpret_cast<const std::uint8_t*>(src_it) ) ) {
+            STRF_CHECK_DEST;
+            const auto count = strf::detail::min<std::size_t>(src_end - src_it, dest_end - dest_it);
+            const auto n = strf::detail::simd::widen_ascii
+                ( reinterpret_cast<const std::uint8_t*>(src_it), count, dest_it );
+            src_it += n;
+            dest_it += n;
+            continue;
+        }
+#endif // defined(STRF_HAS_SIMD)
+        STRF_IF_UNLIKELY ( ! strf::detail::utf8_decode_next(src_it, src_end, ch32, surr_poli)
+                         && inv_seq_notifier ) {
+            dest.advance_to(dest_it);
+            inv_seq_notifier.notify();
         }
-
         STRF_CHECK_DEST;
-        *dest_it = ch32;
+        *dest_it = static_cast<DestCharT>(ch32);
         ++dest_it;
     }
     dest.advance_to(dest_it);
@@ -1153,7 +1260,29 @@ STRF_HD void strf::static_transcoder
     auto src_end = src + src_size;
     auto dest_it = dest.buffer_ptr();
     auto dest_end = dest.buffer_end();
+#if defined(STRF_HAS_SIMD)
+    auto simd_resume_it = src;
+#endif
     while(src_it != src_end) {
+#if defined(STRF_HAS_SIMD)
+        constexpr auto min_simd_size = (std::ptrdiff_t)strf::detail::simd::min_utf8_validation_size;
+        if (src_it >= simd_resume_it && src_end - src_it >= min_simd_size) {
+            auto valid_size = strf::detail::simd::utf8_valid_prefix
+                ( reinterpret_cast<const std::uint8_t*>(src_it), src_end - src_it );
+            while (valid_size != 0) {
+                STRF_CHECK_DEST;
+                const auto count = strf::detail::min<std::size_t>(valid_size, dest_end - dest_it);
+                strf::detail::copy_n(src_it, count, dest_it);
+                src_it += count;
+                dest_it += count;
+                valid_size -= count;
+            }
+            // Let the scalar code below handle the block where the validation
+            // stopped, before trying again
+            simd_resume_it = src_it + strf::detail::min(src_end - src_it, min_simd_size);
+            continue;
+        }
+#endif // defined(STRF_HAS_SIMD)
         ch0 = (*src_it);
         ++src_it;
         if(ch0 < 0x80) {
@@ -1236,7 +1365,21 @@ STRF_HD std::size_t strf::static_transcoder
     const SrcCharT* src_it = src;
     auto src_end = src + src_size;
     std::size_t size = 0;
+#if defined(STRF_HAS_SIMD)
+    auto simd_resume_it = src;
+#endif
     while(src_it != src_end) {
+#if defined(STRF_HAS_SIMD)
+        constexpr auto min_simd_size = (std::ptrdiff_t)strf::detail::simd::min_utf8_validation_size;
+        if (src_it >= simd_resume_it && src_end - src_it >= min_simd_size) {
+            const auto valid_size = strf::detail::simd::utf8_valid_prefix
+                ( reinterpret_cast<const std::uint8_t*>(src_it), src_end - src_it );
+            size += valid_size;
+            src_it += valid_size;
+            simd_resume_it = src_it + strf::detail::min(src_end - src_it, min_simd_size);
+            continue;
+        }
+#endif // defined(STRF_HAS_SIMD)
         ch0 = *src_it;
         ++src_it;
         if(ch0 < 0x80) {
@@ -1907,6 +2050,20 @@ STRF_HD void strf::static_transcoder
 
     for (;src_it != src_end; ++dest_it) {
         ch0 = (*src_it);
+#if defined(STRF_HAS_SIMD)
+        STRF_IF_UNLIKELY ( ch0 < 0x80
+                         && src_end - src_it >= (std::ptrdiff_t)strf::detail::simd::min_simd_input_size
+                         && strf::detail::simd::starts_with_ascii_run
+                             ( reinterpret_cast<const std::uint8_t*>(src_it) ) ) {
+            STRF_CHECK_DEST;
+            const auto count = strf::detail::min<std::size_t>(src_end - src_it, dest_end - dest_it);
+            const auto n = strf::detail::simd::widen_ascii
+                ( reinterpret_cast<const std::uint8_t*>(src_it), count, dest_it );
+            src_it += n;
+            dest_it += n - 1; // the last increment is done by the loop
+            continue;
+        }
+#endif // defined(STRF_HAS_SIMD)
         ++src_it;
         STRF_IF_LIKELY (ch0 < 0x80) {
             STRF_CHECK_DEST;
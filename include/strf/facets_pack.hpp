@@ -632,7 +632,7 @@ public:
 
     template <typename Category, typename Tag>
     constexpr STRF_HD auto get_facet() const
-        -> decltype( this->template do_get_facet<Tag>
+        -> decltype( std::declval<const facets_pack&>().template do_get_facet<Tag>
                       ( strf::rank<sizeof...(FPE)>()
                       , strf::tag<Category>()
                       , std::true_type() ) )
@@ -644,7 +644,7 @@ public:
     }
     template <typename Category, typename Tag>
     constexpr STRF_HD auto use_facet() const
-        -> decltype( this->template do_get_facet<Tag>
+        -> decltype( std::declval<const facets_pack&>().template do_get_facet<Tag>
                        ( strf::rank<sizeof...(FPE)>()
                        , strf::tag<Category>()
                        , std::true_type() ) )
@@ -2174,9 +2174,495 @@ private:
     ErrHandler err_handler_;
 };
 
+// Pre-parsed tr-strings
+//
+// A tr-string can be split in advance into segments that are either
+// a piece of literal text or a reference to an argument, following the
+// same rules that tr_string_write follows at run-time. This is done
+// at compile time for STRF_TR and strf::tr, and once at run-time
+// by strf::tr_template.
+
+constexpr std::size_t tr_segment_no_arg = static_cast<std::size_t>(-1);
+
+struct tr_segment
+{
+    // For literal segments, begin and size delimit the text.
+    // For argument segments, begin is the position of the '{'
+    // that opens the argument, and size is zero.
+    std::size_t begin;
+    std::size_t size;
+    std::size_t arg; // tr_segment_no_arg when the segment is literal text
+};
+
+template <std::size_t MaxSegments>
+struct tr_segments
+{
+    tr_segment segments[MaxSegments];
+    std::size_t num_segments;
+    std::size_t num_args;      // the number of arguments the tr-string requires
+    std::size_t literals_size; // the sum of the sizes of literal segments
+    bool overflow;             // whether the tr-string has more than MaxSegments segments
+};
+
+template <typename CharT>
+STRF_CONSTEXPR_IN_CXX14 STRF_HD std::size_t ct_str_find
+    ( const CharT* str, std::size_t pos, std::size_t len, CharT ch ) noexcept
+{
+    while (pos < len && str[pos] != ch) {
+        ++pos;
+    }
+    return pos;
+}
+
+template <std::size_t MaxSegments>
+STRF_CONSTEXPR_IN_CXX14 STRF_HD void add_tr_segment
+    ( strf::detail::tr_segments<MaxSegments>& r
+    , std::size_t begin
+    , std::size_t size
+    , std::size_t arg ) noexcept
+{
+    if (r.num_segments < MaxSegments) {
+        r.segments[r.num_segments] = {begin, size, arg};
+        ++r.num_segments;
+    } else {
+        r.overflow = true;
+    }
+}
+
+template <std::size_t MaxSegments>
+STRF_CONSTEXPR_IN_CXX14 STRF_HD void add_tr_literal
+    ( strf::detail::tr_segments<MaxSegments>& r
+    , std::size_t begin
+    , std::size_t end ) noexcept
+{
+    if (begin < end) {
+        strf::detail::add_tr_segment(r, begin, end - begin, tr_segment_no_arg);
+        r.literals_size += end - begin;
+    }
+}
+
+template <std::size_t MaxSegments>
+STRF_CONSTEXPR_IN_CXX14 STRF_HD void add_tr_arg
+    ( strf::detail::tr_segments<MaxSegments>& r
+    , std::size_t arg
+    , std::size_t brace_pos ) noexcept
+{
+    strf::detail::add_tr_segment(r, brace_pos, 0, arg);
+    if (arg >= r.num_args) {
+        r.num_args = arg + 1;
+    }
+}
+
+template <std::size_t MaxSegments, typename CharT>
+STRF_CONSTEXPR_IN_CXX14 STRF_HD strf::detail::tr_segments<MaxSegments> parse_tr_string
+    ( const CharT* str, std::size_t len ) noexcept
+{
+    constexpr std::size_t max_arg_index = 0xFFFF;
+    strf::detail::tr_segments<MaxSegments> r{};
+    std::size_t arg_idx = 0;
+    std::size_t i = 0;
+    bool after_brace = false;
+    while (i < len || after_brace) {
+        if (! after_brace) {
+            const auto j = strf::detail::ct_str_find(str, i, len, CharT('{'));
+            strf::detail::add_tr_literal(r, i, j);
+            if (j == len) {
+                break;
+            }
+            i = j + 1;
+        }
+        after_brace = false;
+        const std::size_t brace_pos = i - 1;
+        if (i == len) {
+            strf::detail::add_tr_arg(r, arg_idx, brace_pos);
+            break;
+        }
+        const auto ch = str[i];
+        if (ch == CharT('}')) {
+            strf::detail::add_tr_arg(r, arg_idx, brace_pos);
+            ++arg_idx;
+            ++i;
+        } else if (CharT('0') <= ch && ch <= CharT('9')) {
+            std::size_t value = 0;
+            for (; i < len && CharT('0') <= str[i] && str[i] <= CharT('9'); ++i) {
+                value = value * 10 + static_cast<std::size_t>(str[i] - CharT('0'));
+                if (value > max_arg_index) {
+                    value = max_arg_index;
+                }
+            }
+            strf::detail::add_tr_arg(r, value, brace_pos);
+            i = strf::detail::ct_str_find(str, i, len, CharT('}'));
+            if (i == len) {
+                break;
+            }
+            ++i;
+        } else if (ch == CharT('{')) {
+            const auto j = strf::detail::ct_str_find(str, i + 1, len, CharT('{'));
+            strf::detail::add_tr_literal(r, i, j);
+            if (j == len) {
+                break;
+            }
+            i = j + 1;
+            after_brace = true;
+        } else {
+            if (ch != CharT('-')) {
+                strf::detail::add_tr_arg(r, arg_idx, brace_pos);
+                ++arg_idx;
+            }
+            i = strf::detail::ct_str_find(str, i + 1, len, CharT('}'));
+            if (i == len) {
+                break;
+            }
+            ++i;
+        }
+    }
+    return r;
+}
+
+template <typename Charset, typename ErrHandler, std::size_t MaxSegments>
+class tr_template_printer
+{
+    using char_type = typename Charset::code_unit;
+public:
+
+    template <strf::preview_size SizeRequested>
+    STRF_HD tr_template_printer
+        ( strf::print_preview<SizeRequested, strf::preview_width::no>& preview
+        , const strf::print_preview<SizeRequested, strf::preview_width::no>* args_preview
+        , std::initializer_list<const strf::printer<char_type>*> printers
+        , const char_type* tr_string
+        , std::size_t tr_string_len
+        , const strf::detail::tr_segments<MaxSegments>& segments
+        , Charset charset
+        , ErrHandler err_handler ) noexcept
+        : tr_string_(tr_string)
+        , tr_string_len_(tr_string_len)
+        , segments_(segments)
+        , printers_array_(printers.begin())
+        , num_printers_(printers.size())
+        , charset_(charset)
+        , err_handler_(err_handler)
+    {
+        STRF_IF_CONSTEXPR (static_cast<bool>(SizeRequested)) {
+            preview.add_size(calc_size_(args_preview));
+        } else {
+            (void) args_preview;
+        }
+    }
+
+    STRF_HD void print_to(strf::destination<char_type>& dest) const
+    {
+        STRF_IF_UNLIKELY (segments_.overflow) {
+            strf::detail::tr_string_write
+                ( tr_string_, tr_string_ + tr_string_len_, printers_array_
+                , num_printers_, dest, charset_, err_handler_ );
+            return;
+        }
+        ErrHandler err_handler(err_handler_);
+        const auto* seg = segments_.segments;
+        const auto* const end = seg + segments_.num_segments;
+        for (; seg != end; ++seg) {
+            if (seg->arg == strf::detail::tr_segment_no_arg) {
+                dest.write(tr_string_ + seg->begin, seg->size);
+            } else STRF_IF_LIKELY (seg->arg < num_printers_) {
+                printers_array_[seg->arg]->print_to(dest);
+            } else {
+                charset_.write_replacement_char(dest);
+                err_handler.handle(tr_string_, tr_string_len_, seg->begin, charset_);
+            }
+        }
+    }
+
+private:
+
+    STRF_HD std::size_t calc_size_
+        ( const strf::print_preview<strf::preview_size::no, strf::preview_width::no>* )
+        const noexcept
+    {
+        return 0;
+    }
+
+    STRF_HD std::size_t calc_size_
+        ( const strf::print_preview<strf::preview_size::yes, strf::preview_width::no>*
+          args_preview ) const noexcept
+    {
+        const auto inv_arg_size = charset_.replacement_char_size();
+        STRF_IF_UNLIKELY (segments_.overflow) {
+            return strf::detail::tr_string_size
+                ( args_preview, num_printers_, tr_string_
+                , tr_string_ + tr_string_len_, inv_arg_size );
+        }
+        std::size_t s = segments_.literals_size;
+        const auto* seg = segments_.segments;
+        const auto* const end = seg + segments_.num_segments;
+        for (; seg != end; ++seg) {
+            if (seg->arg != strf::detail::tr_segment_no_arg) {
+                s += ( seg->arg < num_printers_
+                     ? args_preview[seg->arg].accumulated_size()
+                     : inv_arg_size );
+            }
+        }
+        return s;
+    }
+
+    const char_type* tr_string_;
+    std::size_t tr_string_len_;
+    const strf::detail::tr_segments<MaxSegments>& segments_;
+    const strf::printer<char_type>* const * printers_array_;
+    std::size_t num_printers_;
+    Charset charset_;
+    ErrHandler err_handler_;
+};
+
+#if __cpp_constexpr >= 201304
+
+template <std::size_t N, std::size_t M>
+constexpr STRF_HD strf::detail::tr_segments<N> shrink_tr_segments
+    ( const strf::detail::tr_segments<M>& from ) noexcept
+{
+    strf::detail::tr_segments<N> r{};
+    for (std::size_t i = 0; i < from.num_segments; ++i) {
+        r.segments[i] = from.segments[i];
+    }
+    r.num_segments = from.num_segments;
+    r.num_args = from.num_args;
+    r.literals_size = from.literals_size;
+    return r;
+}
+
+template <typename TrStr>
+struct parsed_tr_string
+{
+    // Each segment consumes at least one character of the tr-string
+    static constexpr std::size_t max_segments_ = TrStr::size() + 1;
+
+    static constexpr std::size_t size = strf::detail::parse_tr_string<max_segments_>
+        ( TrStr::data(), TrStr::size() ).num_segments;
+
+    using segments_type = strf::detail::tr_segments<(size ? size : 1)>;
+
+    static constexpr segments_type value =
+        strf::detail::shrink_tr_segments<(size ? size : 1)>
+        ( strf::detail::parse_tr_string<max_segments_>(TrStr::data(), TrStr::size()) );
+};
+
+#if ! defined(__cpp_inline_variables)
+
+template <typename TrStr>
+constexpr typename parsed_tr_string<TrStr>::segments_type parsed_tr_string<TrStr>::value;
+
+#endif
+
+// The type of the objects created by STRF_TR and strf::tr
+template <typename TrStr>
+struct ct_tr_string
+{
+    using char_type = typename TrStr::char_type;
+};
+
+template <typename TrStr, typename CharT>
+class ct_tr_string_printer
+{
+    using parsed_ = strf::detail::parsed_tr_string<TrStr>;
+
+public:
+
+    template <strf::preview_size SizeRequested>
+    STRF_HD ct_tr_string_printer
+        ( strf::print_preview<SizeRequested, strf::preview_width::no>& preview
+        , const strf::print_preview<SizeRequested, strf::preview_width::no>* args_preview
+        , std::initializer_list<const strf::printer<CharT>*> printers ) noexcept
+        : printers_array_(printers.begin())
+    {
+        STRF_IF_CONSTEXPR (static_cast<bool>(SizeRequested)) {
+            preview.add_size
+                ( parsed_::value.literals_size
+                + args_size_<0>(args_preview, has_segment_<0>()) );
+        } else {
+            (void) args_preview;
+        }
+    }
+
+    STRF_HD void print_to(strf::destination<CharT>& dest) const
+    {
+        print_segments_<0>(dest, has_segment_<0>());
+    }
+
+private:
+
+    template <std::size_t I>
+    using has_segment_ = std::integral_constant<bool, (I < parsed_::size)>;
+
+    template <std::size_t I, typename Preview>
+    static STRF_HD std::size_t args_size_(const Preview*, std::false_type) noexcept
+    {
+        return 0;
+    }
+
+    template <std::size_t I, typename Preview>
+    static STRF_HD std::size_t args_size_(const Preview* args_preview, std::true_type) noexcept
+    {
+        constexpr strf::detail::tr_segment seg = parsed_::value.segments[I];
+        const std::size_t s = ( seg.arg == strf::detail::tr_segment_no_arg
+                              ? 0
+                              : args_preview[seg.arg].accumulated_size() );
+        return s + args_size_<I + 1>(args_preview, has_segment_<I + 1>());
+    }
+
+    template <std::size_t I>
+    STRF_HD void print_segments_(strf::destination<CharT>&, std::false_type) const
+    {
+    }
+
+    template <std::size_t I>
+    STRF_HD void print_segments_(strf::destination<CharT>& dest, std::true_type) const
+    {
+        constexpr strf::detail::tr_segment seg = parsed_::value.segments[I];
+        if (seg.arg == strf::detail::tr_segment_no_arg) {
+            dest.write(TrStr::data() + seg.begin, seg.size);
+        } else {
+            printers_array_[seg.arg]->print_to(dest);
+        }
+        print_segments_<I + 1>(dest, has_segment_<I + 1>());
+    }
+
+    const strf::printer<CharT>* const * printers_array_;
+};
+
+#if defined(STRF_HAS_CLASS_TYPE_TEMPLATE_ARGS)
+
+template <typename CharT, std::size_t N>
+struct tr_string_literal
+{
+    using char_type = CharT;
+
+    constexpr tr_string_literal(const CharT (&s)[N]) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            str[i] = s[i];
+        }
+    }
+
+    CharT str[N] = {};
+};
+
+template <strf::detail::tr_string_literal Str>
+struct tr_string_literal_holder
+{
+    using char_type = typename decltype(Str)::char_type;
+
+    static constexpr STRF_HD const char_type* data() noexcept
+    {
+        return Str.str;
+    }
+    static constexpr STRF_HD std::size_t size() noexcept
+    {
+        return sizeof(Str.str) / sizeof(char_type) - 1;
+    }
+};
+
+#endif // defined(STRF_HAS_CLASS_TYPE_TEMPLATE_ARGS)
+
+#endif // __cpp_constexpr >= 201304
 
 } // namespace detail
 
+// A tr-string that is parsed only once, at construction, so that it
+// can be printed many times without being parsed again. It does not
+// own the string, which must outlive the tr_template object.
+// If the tr-string has more than MaxSegments segments, it is parsed
+// again on each usage, like an ordinary tr-string.
+template <typename CharT, std::size_t MaxSegments = 32>
+class tr_template
+{
+    static_assert(MaxSegments != 0, "MaxSegments must not be zero");
+
+public:
+
+    using char_type = CharT;
+
+    STRF_CONSTEXPR_IN_CXX14 STRF_HD tr_template(const CharT* str, std::size_t len) noexcept
+        : str_(str)
+        , len_(len)
+        , segments_(strf::detail::parse_tr_string<MaxSegments>(str, len))
+    {
+    }
+
+    explicit STRF_HD tr_template(const CharT* str) noexcept
+        : tr_template(str, strf::detail::str_length<CharT>(str))
+    {
+    }
+
+#if defined(STRF_HAS_STD_STRING_VIEW)
+
+    template <typename Traits>
+    explicit STRF_CONSTEXPR_IN_CXX14 STRF_HD tr_template
+        ( std::basic_string_view<CharT, Traits> str ) noexcept
+        : tr_template(str.data(), str.size())
+    {
+    }
+
+#endif // defined(STRF_HAS_STD_STRING_VIEW)
+
+    constexpr STRF_HD const CharT* data() const noexcept
+    {
+        return str_;
+    }
+    constexpr STRF_HD std::size_t size() const noexcept
+    {
+        return len_;
+    }
+    // The number of arguments the tr-string refers to
+    constexpr STRF_HD std::size_t num_args() const noexcept
+    {
+        return segments_.num_args;
+    }
+    // Whether the tr-string fits in MaxSegments segments
+    constexpr STRF_HD bool fully_parsed() const noexcept
+    {
+        return ! segments_.overflow;
+    }
+    constexpr STRF_HD const strf::detail::tr_segments<MaxSegments>& segments() const noexcept
+    {
+        return segments_;
+    }
+
+private:
+
+    const CharT* str_;
+    std::size_t len_;
+    strf::detail::tr_segments<MaxSegments> segments_;
+};
+
+#if defined(STRF_HAS_CLASS_TYPE_TEMPLATE_ARGS)
+
+template <strf::detail::tr_string_literal Str>
+constexpr strf::detail::ct_tr_string<strf::detail::tr_string_literal_holder<Str>> tr{};
+
+#endif // defined(STRF_HAS_CLASS_TYPE_TEMPLATE_ARGS)
+
+#if __cpp_constexpr >= 201304
+
+// STRF_TR(STR) creates a tr-string that is parsed at compile time.
+// STR must be a string literal.
+#define STRF_TR(STR)                                                         \
+    ( [] {                                                                    \
+          struct strf_tr_string_ {                                            \
+              using char_type = strf::detail::remove_cvref_t<decltype(*(STR))>; \
+              static constexpr STRF_HD const char_type* data() noexcept       \
+              {                                                               \
+                  return STR;                                                 \
+              }                                                               \
+              static constexpr STRF_HD std::size_t size() noexcept            \
+              {                                                               \
+                  return sizeof(STR) / sizeof(char_type) - 1;                 \
+              }                                                               \
+          };                                                                  \
+          return strf::detail::ct_tr_string<strf_tr_string_>{};               \
+      } () )
+
+#endif // __cpp_constexpr >= 201304
+
 template < typename DestinationCreator
          , typename FPack = strf::facets_pack<> >
 class destination_with_given_size;
@@ -2185,6 +2671,10 @@ template < typename DestinationCreator
          , typename FPack = strf::facets_pack<> >
 class destination_calc_size;
 
+template < typename DestinationCreator
+         , typename FPack = strf::facets_pack<> >
+class destination_calc_size_by_dry_run;
+
 template < typename DestinationCreator
          , typename FPack = strf::facets_pack<> >
 class destination_no_reserve;
@@ -2305,6 +2795,23 @@ public:
                , self.fpack_ };
     }
 
+    constexpr STRF_HD strf::destination_calc_size_by_dry_run<DestinationCreator, FPack>
+    reserve_calc_by_dry_run() const &
+    {
+        return { strf::detail::destination_tag{}
+               , static_cast<const destination_type_*>(this)->destination_creator_
+               , static_cast<const destination_type_*>(this)->fpack_ };
+    }
+
+    STRF_CONSTEXPR_IN_CXX14 strf::destination_calc_size_by_dry_run<DestinationCreator, FPack>
+    STRF_HD reserve_calc_by_dry_run() &&
+    {
+        auto& self = static_cast<destination_type_&>(*this);
+        return { strf::detail::destination_tag{}
+               , self.destination_creator_
+               , self.fpack_ };
+    }
+
     constexpr STRF_HD strf::destination_with_given_size<DestinationCreator, FPack>
     reserve(std::size_t size) const &
     {
@@ -2357,6 +2864,32 @@ public:
 
 #endif
 
+    template <std::size_t MaxSegments, typename ... Args>
+    finish_return_type_ STRF_HD tr
+        ( const strf::tr_template<char_type_, MaxSegments>& tmpl
+        , const Args& ... args ) const &
+    {
+        return tr_template_write_
+            ( tmpl, strf::detail::make_index_sequence<sizeof...(args)>(), args... );
+    }
+
+#if __cpp_constexpr >= 201304
+
+    template <typename TrStr, typename ... Args>
+    finish_return_type_ STRF_HD tr
+        ( strf::detail::ct_tr_string<TrStr>
+        , const Args& ... args ) const &
+    {
+        static_assert( std::is_same<typename TrStr::char_type, char_type_>::value
+                     , "The tr-string and the destination have different character types" );
+        static_assert( strf::detail::parsed_tr_string<TrStr>::value.num_args <= sizeof...(args)
+                     , "The tr-string refers to an argument that was not passed" );
+        return ct_tr_write_<TrStr>
+            ( strf::detail::make_index_sequence<sizeof...(args)>(), args... );
+    }
+
+#endif // __cpp_constexpr >= 201304
+
 private:
 
     static inline STRF_HD const strf::printer<char_type_>&
@@ -2425,6 +2958,82 @@ private:
 
         return self.write_(preview, tr_printer);
     }
+
+    template < std::size_t MaxSegments, std::size_t ... I, typename ... Args >
+    finish_return_type_ STRF_HD tr_template_write_
+        ( const strf::tr_template<char_type_, MaxSegments>& tmpl
+        , strf::detail::index_sequence<I...>
+        , const Args& ... args) const &
+    {
+        constexpr std::size_t args_count = sizeof...(args);
+        Preview preview_arr[args_count ? args_count : 1];
+        const auto& fpack = static_cast<const destination_type_&>(*this).fpack_;
+        (void)fpack;
+        return tr_template_write_2_
+            ( tmpl
+            , preview_arr
+            , { as_printer_cptr_
+                ( printer_<Args>
+                  ( strf::make_printer_input<char_type_>
+                    ( preview_arr[I], fpack, args ) ) )... } );
+    }
+
+    template <std::size_t MaxSegments>
+    finish_return_type_ STRF_HD tr_template_write_2_
+        ( const strf::tr_template<char_type_, MaxSegments>& tmpl
+        , Preview* preview_arr
+        , std::initializer_list<const strf::printer<char_type_>*> args ) const &
+    {
+        const auto& self = static_cast<const destination_type_&>(*this);
+
+        using catenc = strf::charset_c<char_type_>;
+        auto charset = strf::use_facet<catenc, void>(self.fpack_);
+
+        using caterr = strf::tr_error_notifier_c;
+        auto&& err_hdl = strf::use_facet<caterr, void>(self.fpack_);
+        using err_hdl_type = strf::detail::remove_cvref_t<decltype(err_hdl)>;
+
+        Preview preview;
+        strf::detail::tr_template_printer<decltype(charset), err_hdl_type, MaxSegments>
+            tr_printer( preview, preview_arr, args, tmpl.data(), tmpl.size()
+                      , tmpl.segments(), charset, err_hdl );
+
+        return self.write_(preview, tr_printer);
+    }
+
+#if __cpp_constexpr >= 201304
+
+    template < typename TrStr, std::size_t ... I, typename ... Args >
+    finish_return_type_ STRF_HD ct_tr_write_
+        ( strf::detail::index_sequence<I...>
+        , const Args& ... args) const &
+    {
+        constexpr std::size_t args_count = sizeof...(args);
+        Preview preview_arr[args_count ? args_count : 1];
+        const auto& fpack = static_cast<const destination_type_&>(*this).fpack_;
+        (void)fpack;
+        return ct_tr_write_2_<TrStr>
+            ( preview_arr
+            , { as_printer_cptr_
+                ( printer_<Args>
+                  ( strf::make_printer_input<char_type_>
+                    ( preview_arr[I], fpack, args ) ) )... } );
+    }
+
+    template <typename TrStr>
+    finish_return_type_ STRF_HD ct_tr_write_2_
+        ( Preview* preview_arr
+        , std::initializer_list<const strf::printer<char_type_>*> args ) const &
+    {
+        const auto& self = static_cast<const destination_type_&>(*this);
+        Preview preview;
+        strf::detail::ct_tr_string_printer<TrStr, char_type_>
+            tr_printer(preview, preview_arr, args);
+
+        return self.write_(preview, tr_printer);
+    }
+
+#endif // __cpp_constexpr >= 201304
 };
 
 }// namespace detail
@@ -2487,6 +3096,7 @@ public:
     using common_::operator();
     using common_::tr;
     using common_::reserve_calc;
+    using common_::reserve_calc_by_dry_run;
     using common_::reserve;
 
     STRF_CONSTEXPR_IN_CXX14 STRF_HD destination_no_reserve& no_reserve() &
@@ -2610,6 +3220,7 @@ public:
     using common_::operator();
     using common_::tr;
     using common_::reserve_calc;
+    using common_::reserve_calc_by_dry_run;
     using common_::no_reserve;
 
     STRF_CONSTEXPR_IN_CXX14 STRF_HD destination_with_given_size& reserve(std::size_t size) &
@@ -2728,6 +3339,7 @@ public:
     using common_::tr;
     using common_::no_reserve;
     using common_::reserve;
+    using common_::reserve_calc_by_dry_run;
 
     constexpr STRF_HD const destination_calc_size & reserve_calc() const &
     {
@@ -2789,6 +3401,135 @@ private:
     FPack fpack_;
 };
 
+// Instead of calculating the size with print_preview, prints
+// the arguments twice: first into a size_counter, and then into the
+// destination created with the counted size. This way, the size is
+// exact even with printers that do not implement the size preview.
+template < typename DestinationCreator, typename FPack >
+class destination_calc_size_by_dry_run
+    : public strf::detail::destination_common
+        < strf::destination_calc_size_by_dry_run
+        , true
+        , DestinationCreator
+        , strf::no_print_preview
+        , FPack >
+{
+    using common_ = strf::detail::destination_common
+        < strf::destination_calc_size_by_dry_run
+        , true
+        , DestinationCreator
+        , strf::no_print_preview
+        , FPack >;
+
+    template < template <typename, typename> class, bool, class, class, class>
+    friend class strf::detail::destination_common;
+
+    using preview_type_ = strf::no_print_preview;
+    using finish_return_type_ = strf::detail::destination_finish_return_type<DestinationCreator, true>;
+
+public:
+
+    using char_type = typename DestinationCreator::char_type;
+
+    template < typename ... Args
+             , strf::detail::enable_if_t
+                 < std::is_constructible<DestinationCreator, Args...>::value
+                 , int > = 0 >
+    constexpr STRF_HD destination_calc_size_by_dry_run(Args&&... args)
+        : destination_creator_(std::forward<Args>(args)...)
+    {
+    }
+
+    template < typename T = DestinationCreator
+             , strf::detail::enable_if_t
+                 < std::is_copy_constructible<T>::value, int > = 0 >
+    constexpr STRF_HD destination_calc_size_by_dry_run
+        ( strf::detail::destination_tag
+        , const DestinationCreator& oc
+        , const FPack& fp )
+        : destination_creator_(oc)
+        , fpack_(fp)
+    {
+    }
+
+    constexpr STRF_HD destination_calc_size_by_dry_run
+        ( strf::detail::destination_tag
+        , DestinationCreator&& oc
+        , FPack&& fp )
+        : destination_creator_(std::move(oc))
+        , fpack_(std::move(fp))
+    {
+    }
+
+    using common_::with;
+    using common_::operator();
+    using common_::tr;
+    using common_::no_reserve;
+    using common_::reserve;
+    using common_::reserve_calc;
+
+    constexpr STRF_HD const destination_calc_size_by_dry_run & reserve_calc_by_dry_run() const &
+    {
+        return *this;
+    }
+    STRF_CONSTEXPR_IN_CXX14 STRF_HD destination_calc_size_by_dry_run & reserve_calc_by_dry_run() &
+    {
+        return *this;
+    }
+    constexpr STRF_HD const destination_calc_size_by_dry_run && reserve_calc_by_dry_run() const &&
+    {
+        return std::move(*this);
+    }
+    STRF_CONSTEXPR_IN_CXX14 STRF_HD destination_calc_size_by_dry_run && reserve_calc_by_dry_run() &&
+    {
+        return std::move(*this);
+    }
+
+private:
+
+    template <typename, typename>
+    friend class destination_calc_size_by_dry_run;
+
+    template < typename OtherFPack
+             , typename ... FPE
+             , typename T = DestinationCreator
+             , strf::detail::enable_if_t<std::is_copy_constructible<T>::value, int> = 0 >
+    STRF_HD destination_calc_size_by_dry_run
+        ( const destination_calc_size_by_dry_run<DestinationCreator, OtherFPack>& other
+        , detail::destination_tag
+        , FPE&& ... fpe )
+        : destination_creator_(other.destination_creator_)
+        , fpack_(other.fpack_, std::forward<FPE>(fpe)...)
+    {
+    }
+
+    template < typename OtherFPack, typename ... FPE >
+    STRF_HD destination_calc_size_by_dry_run
+        ( destination_calc_size_by_dry_run<DestinationCreator, OtherFPack>&& other
+        , detail::destination_tag
+        , FPE&& ... fpe )
+        : destination_creator_(std::move(other.destination_creator_))
+        , fpack_(std::move(other.fpack_), std::forward<FPE>(fpe)...)
+    {
+    }
+
+    template <typename ... Printers>
+    finish_return_type_ STRF_HD write_
+        ( const preview_type_&
+        , const Printers& ... printers ) const
+    {
+        strf::size_counter<char_type> counter;
+        strf::detail::write_args(counter, printers...);
+        typename DestinationCreator::sized_destination_type dest
+            { destination_creator_.create(counter.count()) };
+        strf::detail::write_args(dest, printers...);
+        return strf::detail::finish(strf::rank<2>(), dest);
+    }
+
+    DestinationCreator destination_creator_;
+    FPack fpack_;
+};
+
 namespace detail {
 
 template <typename CharT>
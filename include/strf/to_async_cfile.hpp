@@ -0,0 +1,413 @@
+#ifndef STRF_DETAIL_OUTPUT_TYPES_ASYNC_CFILE_HPP
+#define STRF_DETAIL_OUTPUT_TYPES_ASYNC_CFILE_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <strf/to_cfile.hpp>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#if defined(_WIN32)
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
+namespace strf {
+
+namespace detail {
+
+// A lock-free queue with one producer thread and one consumer thread
+template <typename T>
+class spsc_queue
+{
+public:
+
+    explicit spsc_queue(std::size_t capacity)
+        : slots_(new T[capacity])
+        , capacity_(capacity)
+    {
+    }
+
+    bool push(const T& value) noexcept
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == capacity_) {
+            return false;
+        }
+        slots_[tail % capacity_] = value;
+        // seq_cst, for the sleeping/waking protocol of async_cfile_writer_base
+        tail_.store(tail + 1, std::memory_order_seq_cst);
+        return true;
+    }
+
+    bool pop(T& value) noexcept
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = slots_[head % capacity_];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const noexcept
+    {
+        return head_.load(std::memory_order_seq_cst) == tail_.load(std::memory_order_seq_cst);
+    }
+
+private:
+
+    std::unique_ptr<T[]> slots_;
+    const std::size_t capacity_;
+    std::atomic<std::size_t> head_{0};
+    std::atomic<std::size_t> tail_{0};
+};
+
+template <typename CharT>
+class async_cfile_writer_traits {
+public:
+    async_cfile_writer_traits() = delete;
+    async_cfile_writer_traits(const async_cfile_writer_traits&) = default;
+
+    async_cfile_writer_traits(FILE* file)
+        : file_(file)
+    {
+    }
+
+    std::size_t write(const CharT* ptr, std::size_t count) noexcept {
+        return std::fwrite(ptr, sizeof(CharT), count, file_);
+    }
+
+    // Flushes the FILE and waits until the content reaches the storage device.
+    // Pipes, terminals and special files like /dev/null can not be synced,
+    // which is not considered an error, since all the content was written.
+    bool sync() noexcept {
+        if (std::fflush(file_) != 0) {
+            return false;
+        }
+#if defined(_WIN32)
+        return _commit(_fileno(file_)) == 0 || errno == EBADF || errno == EINVAL;
+#else
+        return ::fsync(fileno(file_)) == 0 || nothing_to_sync_(errno);
+#endif
+    }
+
+private:
+
+#if ! defined(_WIN32)
+    static bool nothing_to_sync_(int err) noexcept {
+        return err == EINVAL || err == EROFS || err == ENOTSUP;
+    }
+#endif
+
+    FILE* file_;
+};
+
+struct async_cfile_writer_result {
+    std::size_t count;
+    bool success;
+    int error; // the errno value set by the failed write or sync, or zero
+};
+
+// Hands each full buffer to a background thread, which writes it,
+// and continues into another buffer from a small pool. When all the
+// buffers are waiting to be written, recycle() blocks until one of
+// them is available again.
+//
+// The buffers are passed through lock-free queues. The threads only
+// lock the mutex to sleep, when there is nothing to do.
+//
+// The purpose of the Traits template parameter is to enable the
+// unit tests to simulate slow and unsuccessful writings.
+template <typename CharT, typename Traits>
+class async_cfile_writer_base
+    : public strf::destination<CharT>
+{
+    static_assert(noexcept(std::declval<Traits>().write(nullptr, 0)), "");
+    static_assert(noexcept(std::declval<Traits>().sync()), "");
+
+public:
+
+    template <typename... TraitsInitArgs>
+    async_cfile_writer_base
+        ( std::size_t buffer_size
+        , std::size_t buffers_count
+        , TraitsInitArgs&&... args )
+        : strf::destination<CharT>(nullptr, nullptr)
+        , buffer_size_(strf::detail::max(buffer_size, strf::min_space_after_recycle<CharT>()))
+        , buffers_count_(strf::detail::max(buffers_count, std::size_t{2}))
+        , buffers_(new CharT[buffer_size_ * buffers_count_])
+        , free_buffers_(buffers_count_)
+        , full_buffers_(buffers_count_ + 1) // +1 for the stop request
+        , traits_(std::forward<TraitsInitArgs>(args)...)
+    {
+        for (std::size_t i = 1; i < buffers_count_; ++i) {
+            free_buffers_.push(buffers_.get() + i * buffer_size_);
+        }
+        set_buffer_(buffers_.get());
+        thread_ = std::thread(&async_cfile_writer_base::run_, this);
+    }
+
+    async_cfile_writer_base(const async_cfile_writer_base&) = delete;
+    async_cfile_writer_base(async_cfile_writer_base&&) = delete;
+
+    ~async_cfile_writer_base()
+    {
+        finish_(false);
+    }
+
+    void recycle() override
+    {
+        STRF_IF_LIKELY (this->good()) {
+            submit_(this->buffer_ptr());
+            STRF_IF_LIKELY ( ! failed_.load(std::memory_order_acquire)) {
+                CharT* buff = nullptr;
+                while ( ! free_buffers_.pop(buff)) {
+                    // back-pressure: all buffers are waiting to be written
+                    sleep_until_(producer_sleeping_, [this](){ return ! free_buffers_.empty(); });
+                }
+                set_buffer_(buff);
+                return;
+            }
+            this->set_good(false);
+        }
+        this->set_buffer_ptr(strf::garbage_buff<CharT>());
+        this->set_buffer_end(strf::garbage_buff_end<CharT>());
+    }
+
+    using result = strf::detail::async_cfile_writer_result;
+
+    // Waits until everything is written, and then calls Traits::sync,
+    // which, in the case of async_cfile_writer, flushes the FILE and
+    // waits until the content reaches the storage device
+    result finish()
+    {
+        return finish_(true);
+    }
+
+private:
+
+    struct chunk_ {
+        CharT* ptr;
+        std::size_t count;
+    };
+
+    void set_buffer_(CharT* buff) noexcept
+    {
+        buff_ = buff;
+        this->set_buffer_ptr(buff);
+        this->set_buffer_end(buff + buffer_size_);
+    }
+
+    void submit_(CharT* ptr) noexcept
+    {
+        full_buffers_.push({buff_, static_cast<std::size_t>(ptr - buff_)});
+        wake_(consumer_sleeping_);
+    }
+
+    result finish_(bool sync) noexcept
+    {
+        if (thread_.joinable()) {
+            const bool g = this->good();
+            this->set_good(false);
+            if (g && this->buffer_ptr() != buff_) {
+                submit_(this->buffer_ptr());
+            }
+            this->set_buffer_ptr(strf::garbage_buff<CharT>());
+            this->set_buffer_end(strf::garbage_buff_end<CharT>());
+
+            full_buffers_.push({nullptr, 0}); // the stop request
+            wake_(consumer_sleeping_);
+            thread_.join();
+
+            result_.success = g && ! failed_.load(std::memory_order_relaxed);
+            if (result_.success && sync && ! traits_.sync()) {
+                result_.success = false;
+                error_ = errno;
+            }
+            result_.count = count_;
+            result_.error = error_;
+        }
+        return result_;
+    }
+
+    // The function executed by the background thread
+    void run_() noexcept
+    {
+        for (;;) {
+            chunk_ c;
+            if (full_buffers_.pop(c)) {
+                if (c.ptr == nullptr) {
+                    return;
+                }
+                if ( ! failed_.load(std::memory_order_relaxed)) {
+                    const std::size_t n = traits_.write(c.ptr, c.count);
+                    count_ += n;
+                    if (n != c.count) {
+                        error_ = errno;
+                        failed_.store(true, std::memory_order_release);
+                    }
+                }
+                free_buffers_.push(c.ptr);
+                wake_(producer_sleeping_);
+            } else {
+                sleep_until_(consumer_sleeping_, [this](){ return ! full_buffers_.empty(); });
+            }
+        }
+    }
+
+    template <typename Predicate>
+    void sleep_until_(std::atomic<bool>& sleeping, Predicate pred) noexcept
+    {
+        // Since the push into the queue, the store and the load of the
+        // sleeping flag and the load in pred are all sequentially
+        // consistent, either the other thread sees the sleeping flag
+        // in wake_, or pred sees the new state of the queue.
+        sleeping.store(true, std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, pred);
+        }
+        sleeping.store(false, std::memory_order_relaxed);
+    }
+
+    void wake_(std::atomic<bool>& sleeping) noexcept
+    {
+        if (sleeping.load(std::memory_order_seq_cst)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cv_.notify_all();
+        }
+    }
+
+    const std::size_t buffer_size_;
+    const std::size_t buffers_count_;
+    std::unique_ptr<CharT[]> buffers_;
+    CharT* buff_ = nullptr;
+
+    strf::detail::spsc_queue<CharT*> free_buffers_;
+    strf::detail::spsc_queue<chunk_> full_buffers_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<bool> producer_sleeping_{false};
+    std::atomic<bool> consumer_sleeping_{false};
+    std::atomic<bool> failed_{false};
+
+    // only accessed by the background thread, until it is joined
+    std::size_t count_ = 0;
+    int error_ = 0;
+
+    result result_{0, false, 0};
+    Traits traits_;
+    std::thread thread_;
+};
+
+} // namespace detail
+
+template <typename CharT>
+class async_cfile_writer final
+    : public strf::detail::async_cfile_writer_base
+        < CharT, strf::detail::async_cfile_writer_traits<CharT> >
+{
+    using impl_ = strf::detail::async_cfile_writer_base
+        < CharT, strf::detail::async_cfile_writer_traits<CharT> >;
+public:
+
+    static constexpr std::size_t default_buffer_size = 65536 / sizeof(CharT);
+    static constexpr std::size_t default_buffers_count = 4;
+
+    struct params {
+        std::FILE* file;
+        std::size_t buffer_size;   // in characters
+        std::size_t buffers_count;
+    };
+
+    explicit async_cfile_writer(params p)
+        : async_cfile_writer(p.file, p.buffer_size, p.buffers_count)
+    {
+    }
+
+    explicit async_cfile_writer
+        ( std::FILE* file
+        , std::size_t buffer_size = default_buffer_size
+        , std::size_t buffers_count = default_buffers_count )
+        : impl_(buffer_size, buffers_count, file)
+    {
+        STRF_ASSERT(file != nullptr);
+    }
+
+    async_cfile_writer() = delete;
+    async_cfile_writer(const async_cfile_writer&) = delete;
+    async_cfile_writer(async_cfile_writer&&) = delete;
+
+    ~async_cfile_writer() = default;
+
+    using result = typename impl_::result;
+    using impl_::recycle;
+    using impl_::finish;
+};
+
+#if ! defined(__cpp_inline_variables)
+
+template <typename CharT>
+constexpr std::size_t async_cfile_writer<CharT>::default_buffer_size;
+
+template <typename CharT>
+constexpr std::size_t async_cfile_writer<CharT>::default_buffers_count;
+
+#endif
+
+namespace detail {
+
+template <typename CharT>
+class async_cfile_writer_creator
+{
+public:
+
+    using char_type = CharT;
+    using destination_type = strf::async_cfile_writer<CharT>;
+    using finish_type = typename destination_type::result;
+
+    constexpr async_cfile_writer_creator(FILE* file) noexcept
+        : file_(file)
+    {}
+
+    constexpr async_cfile_writer_creator(const async_cfile_writer_creator&) = default;
+
+    typename destination_type::params create() const noexcept
+    {
+        return { file_
+               , destination_type::default_buffer_size
+               , destination_type::default_buffers_count };
+    }
+
+private:
+    FILE* file_;
+};
+
+} // namespace detail
+
+// Since each call creates a new async_cfile_writer, and hence a new
+// thread, this is only worth it for large contents. To print many
+// times, create an async_cfile_writer object and use strf::to on it.
+template <typename CharT = char>
+inline auto to_async(std::FILE* destfile)
+    -> strf::destination_no_reserve<strf::detail::async_cfile_writer_creator<CharT>>
+{
+    return strf::destination_no_reserve
+        < strf::detail::async_cfile_writer_creator<CharT> >
+        (destfile);
+}
+
+} // namespace strf
+
+#endif  // STRF_DETAIL_OUTPUT_TYPES_ASYNC_CFILE_HPP
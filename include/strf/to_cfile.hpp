@@ -39,6 +39,52 @@ private:
     FILE* file_;
 };
 
+// Used while the FILE is locked by the calling thread
+template <typename CharT>
+class unlocked_cfile_writer_traits {
+public:
+    unlocked_cfile_writer_traits() = delete;
+    unlocked_cfile_writer_traits(const unlocked_cfile_writer_traits&) = default;
+
+    STRF_HD unlocked_cfile_writer_traits(FILE* file)
+        : file_(file)
+    {
+    }
+
+    STRF_HD std::size_t write(const CharT* ptr, std::size_t count) const noexcept {
+#if defined(_WIN32)
+        return _fwrite_nolock(ptr, sizeof(CharT), count, file_);
+#elif defined(__GLIBC__)
+        return fwrite_unlocked(ptr, sizeof(CharT), count, file_);
+#else
+        // The lock is recursive, and it is already held by this thread,
+        // so acquiring it again is cheap.
+        return std::fwrite(ptr, sizeof(CharT), count, file_);
+#endif
+    }
+
+private:
+    FILE* file_;
+};
+
+STRF_HD inline void lock_cfile(FILE* file) noexcept
+{
+#if defined(_WIN32)
+    _lock_file(file);
+#else
+    flockfile(file);
+#endif
+}
+
+STRF_HD inline void unlock_cfile(FILE* file) noexcept
+{
+#if defined(_WIN32)
+    _unlock_file(file);
+#else
+    funlockfile(file);
+#endif
+}
+
 class wide_cfile_writer_traits {
 public:
     wide_cfile_writer_traits() = delete;
@@ -183,6 +229,53 @@ private:
     CharT buf_[BuffSize];
 };
 
+// Locks the FILE in the constructor and unlocks it in the destructor,
+// so that the FILE lock is taken only once for the whole content,
+// and the content is not interleaved with what other threads write
+// into the same FILE.
+template <typename CharT, std::size_t BuffSize>
+class locked_cfile_writer final
+    : public strf::detail::cfile_writer_base
+        < CharT, strf::detail::unlocked_cfile_writer_traits<CharT> >
+{
+    static_assert(BuffSize >= strf::min_space_after_recycle<CharT>(), "BuffSize too small");
+
+    using impl_ = strf::detail::cfile_writer_base
+        < CharT, strf::detail::unlocked_cfile_writer_traits<CharT> >;
+public:
+
+    explicit STRF_HD locked_cfile_writer(std::FILE* file)
+        : impl_(buf_, BuffSize, file)
+        , file_(file)
+    {
+        STRF_ASSERT(file != nullptr);
+        strf::detail::lock_cfile(file);
+    }
+
+    STRF_HD locked_cfile_writer() = delete;
+
+    locked_cfile_writer(const locked_cfile_writer&) = delete;
+    locked_cfile_writer(locked_cfile_writer&&) = delete;
+
+    STRF_HD ~locked_cfile_writer()
+    {
+        if (this->good()) {
+            // flush before unlocking
+            impl_::finish();
+        }
+        strf::detail::unlock_cfile(file_);
+    }
+
+    using result = typename impl_::result;
+    using impl_::recycle;
+    using impl_::finish;
+
+private:
+
+    std::FILE* file_;
+    CharT buf_[BuffSize];
+};
+
 class wide_cfile_writer final
     : public strf::detail::cfile_writer_base
         < wchar_t, strf::detail::wide_cfile_writer_traits >
@@ -215,13 +308,13 @@ private:
 
 namespace detail {
 
-template <typename CharT>
+template <typename CharT, std::size_t BuffSize>
 class narrow_cfile_writer_creator
 {
 public:
 
     using char_type = CharT;
-    using destination_type = strf::narrow_cfile_writer<CharT, strf::min_space_after_recycle<CharT>()>;
+    using destination_type = strf::narrow_cfile_writer<CharT, BuffSize>;
     using finish_type = typename destination_type::result;
 
     constexpr STRF_HD narrow_cfile_writer_creator(FILE* file) noexcept
@@ -239,6 +332,30 @@ private:
     FILE* file_;
 };
 
+template <typename CharT, std::size_t BuffSize>
+class locked_cfile_writer_creator
+{
+public:
+
+    using char_type = CharT;
+    using destination_type = strf::locked_cfile_writer<CharT, BuffSize>;
+    using finish_type = typename destination_type::result;
+
+    constexpr STRF_HD locked_cfile_writer_creator(FILE* file) noexcept
+        : file_(file)
+    {}
+
+    constexpr locked_cfile_writer_creator(const locked_cfile_writer_creator&) = default;
+
+    STRF_HD FILE* create() const
+    {
+        return file_;
+    }
+
+private:
+    FILE* file_;
+};
+
 class wide_cfile_writer_creator
 {
 public:
@@ -268,10 +385,49 @@ private:
 
 template <typename CharT = char>
 STRF_HD inline auto to(std::FILE* destfile)
-    -> strf::destination_no_reserve<strf::detail::narrow_cfile_writer_creator<CharT>>
+    -> strf::destination_no_reserve
+        < strf::detail::narrow_cfile_writer_creator
+            < CharT, strf::min_space_after_recycle<CharT>() > >
+{
+    return strf::destination_no_reserve
+        < strf::detail::narrow_cfile_writer_creator
+            < CharT, strf::min_space_after_recycle<CharT>() > >
+        (destfile);
+}
+
+// BuffSize is the number of characters of the buffer, which is
+// allocated inside the destination object ( usually on the stack ).
+// A bigger buffer reduces the number of calls to fwrite.
+template <std::size_t BuffSize, typename CharT = char>
+STRF_HD inline auto to(std::FILE* destfile)
+    -> strf::destination_no_reserve<strf::detail::narrow_cfile_writer_creator<CharT, BuffSize>>
+{
+    return strf::destination_no_reserve
+        < strf::detail::narrow_cfile_writer_creator<CharT, BuffSize> >
+        (destfile);
+}
+
+// Like strf::to(FILE*), but the FILE is locked only once for the
+// whole content, with flockfile, and written with fwrite_unlocked
+// where available.
+template <typename CharT = char>
+STRF_HD inline auto to_locked(std::FILE* destfile)
+    -> strf::destination_no_reserve
+        < strf::detail::locked_cfile_writer_creator
+            < CharT, strf::min_space_after_recycle<CharT>() > >
+{
+    return strf::destination_no_reserve
+        < strf::detail::locked_cfile_writer_creator
+            < CharT, strf::min_space_after_recycle<CharT>() > >
+        (destfile);
+}
+
+template <std::size_t BuffSize, typename CharT = char>
+STRF_HD inline auto to_locked(std::FILE* destfile)
+    -> strf::destination_no_reserve<strf::detail::locked_cfile_writer_creator<CharT, BuffSize>>
 {
     return strf::destination_no_reserve
-        < strf::detail::narrow_cfile_writer_creator<CharT> >
+        < strf::detail::locked_cfile_writer_creator<CharT, BuffSize> >
         (destfile);
 }
 
@@ -0,0 +1,372 @@
+#ifndef STRF_DETAIL_OUTPUT_TYPES_CHUNKS_HPP
+#define STRF_DETAIL_OUTPUT_TYPES_CHUNKS_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <strf/destination.hpp>
+#include <strf.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace strf {
+
+template <typename CharT, typename Allocator>
+class basic_chunked_writer;
+
+// The content written by basic_chunked_writer: a sequence of chunks
+// of memory obtained from Allocator.
+template <typename CharT, typename Allocator = std::allocator<CharT> >
+class basic_chunk_list
+{
+    using alloc_traits_ = std::allocator_traits<Allocator>;
+
+public:
+
+    struct chunk {
+        CharT* data;
+        std::size_t size;     // the number of characters written
+        std::size_t capacity; // the number of characters allocated
+    };
+
+    using const_iterator = const chunk*;
+
+    explicit basic_chunk_list(const Allocator& a = Allocator())
+        : chunks_(chunk_allocator_(a))
+        , alloc_(a)
+    {
+    }
+
+    basic_chunk_list(const basic_chunk_list&) = delete;
+
+    basic_chunk_list(basic_chunk_list&& other) noexcept
+        : chunks_(std::move(other.chunks_))
+        , alloc_(other.alloc_)
+    {
+        other.chunks_.clear();
+    }
+
+    basic_chunk_list& operator=(const basic_chunk_list&) = delete;
+
+    // When the allocator does not propagate on move assignment and
+    // is not equal to the one of other, the chunks are reallocated
+    basic_chunk_list& operator=(basic_chunk_list&& other)
+        noexcept(alloc_traits_::propagate_on_container_move_assignment::value)
+    {
+        if (this != &other) {
+            deallocate_all_();
+            move_assign_
+                ( other
+                , typename alloc_traits_::propagate_on_container_move_assignment{} );
+        }
+        return *this;
+    }
+
+    ~basic_chunk_list()
+    {
+        deallocate_all_();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return chunks_.data();
+    }
+    const_iterator end() const noexcept
+    {
+        return chunks_.data() + chunks_.size();
+    }
+    // The number of chunks
+    std::size_t size() const noexcept
+    {
+        return chunks_.size();
+    }
+    const chunk& operator[](std::size_t i) const noexcept
+    {
+        return chunks_[i];
+    }
+    // The number of characters in all chunks
+    std::size_t total_size() const noexcept
+    {
+        std::size_t s = 0;
+        for (const auto& c : chunks_) {
+            s += c.size;
+        }
+        return s;
+    }
+
+    // Copies the content into a contiguous array, which must have at
+    // least total_size() elements. Returns the end of the copied content.
+    CharT* copy_to(CharT* dest) const noexcept
+    {
+        for (const auto& c : chunks_) {
+            strf::detail::copy_n(c.data, c.size, dest);
+            dest += c.size;
+        }
+        return dest;
+    }
+
+    template < typename Traits = std::char_traits<CharT>
+             , typename StrAllocator = std::allocator<CharT> >
+    std::basic_string<CharT, Traits, StrAllocator> to_string() const
+    {
+        std::basic_string<CharT, Traits, StrAllocator> str;
+        str.reserve(total_size());
+        for (const auto& c : chunks_) {
+            str.append(c.data, c.size);
+        }
+        return str;
+    }
+
+private:
+
+    template <typename, typename>
+    friend class strf::basic_chunked_writer;
+
+    using chunk_allocator_ = typename alloc_traits_::template rebind_alloc<chunk>;
+
+    // Appends a new chunk with the given capacity and returns
+    // a pointer to its memory
+    CharT* add_chunk_(std::size_t capacity)
+    {
+        // reserving before allocating the chunk ensures that it is not
+        // leaked if push_back throws. The growth must still be geometric.
+        if (chunks_.size() == chunks_.capacity()) {
+            chunks_.reserve(2 * chunks_.size() + 1);
+        }
+        CharT* p = alloc_traits_::allocate(alloc_, capacity);
+        chunks_.push_back(chunk{p, 0, capacity});
+        return p;
+    }
+
+    void move_assign_(basic_chunk_list& other, std::true_type) noexcept
+    {
+        chunks_ = std::move(other.chunks_);
+        alloc_ = std::move(other.alloc_);
+        other.chunks_.clear();
+    }
+
+    void move_assign_(basic_chunk_list& other, std::false_type)
+    {
+        if (alloc_ == other.alloc_) {
+            chunks_ = std::move(other.chunks_);
+            other.chunks_.clear();
+            return;
+        }
+        chunks_.reserve(other.chunks_.size());
+        for (const auto& c : other.chunks_) {
+            CharT* p = alloc_traits_::allocate(alloc_, c.size);
+            strf::detail::copy_n(c.data, c.size, p);
+            chunks_.push_back(chunk{p, c.size, c.size});
+        }
+        other.deallocate_all_();
+    }
+
+    void deallocate_all_() noexcept
+    {
+        for (const auto& c : chunks_) {
+            alloc_traits_::deallocate(alloc_, c.data, c.capacity);
+        }
+        chunks_.clear();
+    }
+
+    std::vector<chunk, chunk_allocator_> chunks_;
+    Allocator alloc_;
+};
+
+// A destination that writes into chunks of memory obtained from
+// Allocator, which may be an arena allocator. Already written content
+// is never moved: when a chunk is full, another one is allocated,
+// with twice the capacity of the previous one, up to max_chunk_size.
+// If first_chunk_size and max_chunk_size are equal, all chunks have
+// the same size.
+template <typename CharT, typename Allocator = std::allocator<CharT> >
+class basic_chunked_writer final: public strf::destination<CharT>
+{
+public:
+
+    static constexpr std::size_t default_first_chunk_size = 256;
+    static constexpr std::size_t default_max_chunk_size = 64 * 1024;
+
+    struct params {
+        std::size_t first_chunk_size;
+        std::size_t max_chunk_size;
+        Allocator allocator;
+    };
+
+    explicit basic_chunked_writer(const Allocator& a = Allocator())
+        : basic_chunked_writer
+            ( params{default_first_chunk_size, default_max_chunk_size, a} )
+    {
+    }
+
+    basic_chunked_writer
+        ( std::size_t first_chunk_size
+        , std::size_t max_chunk_size
+        , const Allocator& a = Allocator() )
+        : basic_chunked_writer(params{first_chunk_size, max_chunk_size, a})
+    {
+    }
+
+    explicit basic_chunked_writer(const params& p)
+        : strf::destination<CharT>(nullptr, nullptr)
+        , chunks_(p.allocator)
+        , next_chunk_size_(p.first_chunk_size)
+        , max_chunk_size_(p.max_chunk_size)
+    {
+        constexpr std::size_t min_size = strf::min_space_after_recycle<CharT>();
+        if (next_chunk_size_ < min_size) {
+            next_chunk_size_ = min_size;
+        }
+        if (max_chunk_size_ < next_chunk_size_) {
+            max_chunk_size_ = next_chunk_size_;
+        }
+        add_chunk_(next_chunk_size_);
+    }
+
+    basic_chunked_writer(const basic_chunked_writer&) = delete;
+    basic_chunked_writer(basic_chunked_writer&&) = delete;
+
+    void recycle() override
+    {
+        STRF_IF_LIKELY (this->good()) {
+            this->set_good(false); // in case the following code throws
+            close_current_chunk_();
+            add_chunk_(next_chunk_size_);
+            this->set_good(true);
+        } else {
+            this->set_buffer_ptr(strf::garbage_buff<CharT>());
+        }
+    }
+
+    using result = strf::basic_chunk_list<CharT, Allocator>;
+
+    result finish()
+    {
+        STRF_IF_LIKELY (this->good()) {
+            close_current_chunk_();
+        }
+        this->set_good(false);
+        this->set_buffer_ptr(strf::garbage_buff<CharT>());
+        this->set_buffer_end(strf::garbage_buff_end<CharT>());
+        return std::move(chunks_);
+    }
+
+    // Copies the whole content into a single string
+    template < typename Traits = std::char_traits<CharT>
+             , typename StrAllocator = std::allocator<CharT> >
+    std::basic_string<CharT, Traits, StrAllocator> finish_to_string()
+    {
+        return finish().template to_string<Traits, StrAllocator>();
+    }
+
+private:
+
+    void do_write(const CharT* str, std::size_t str_len) override
+    {
+        STRF_IF_LIKELY (this->good()) {
+            const auto space = this->buffer_space();
+            strf::detail::copy_n(str, space, this->buffer_ptr());
+            this->advance(space);
+            str += space;
+            str_len -= space;
+
+            this->set_good(false); // in case the following code throws
+            close_current_chunk_();
+            // a chunk that fits all the remaining content
+            add_chunk_(strf::detail::max(next_chunk_size_, str_len));
+            strf::detail::copy_n(str, str_len, this->buffer_ptr());
+            this->advance(str_len);
+            this->set_good(true);
+        }
+    }
+
+    void close_current_chunk_() noexcept
+    {
+        auto& c = chunks_.chunks_.back();
+        c.size = this->buffer_ptr() - c.data;
+    }
+
+    void add_chunk_(std::size_t capacity)
+    {
+        CharT* p = chunks_.add_chunk_(capacity);
+        this->set_buffer_ptr(p);
+        this->set_buffer_end(p + capacity);
+        next_chunk_size_ = strf::detail::min(next_chunk_size_ * 2, max_chunk_size_);
+    }
+
+    result chunks_;
+    std::size_t next_chunk_size_;
+    std::size_t max_chunk_size_;
+};
+
+#if ! defined(__cpp_inline_variables)
+
+template <typename CharT, typename Allocator>
+constexpr std::size_t basic_chunked_writer<CharT, Allocator>::default_first_chunk_size;
+
+template <typename CharT, typename Allocator>
+constexpr std::size_t basic_chunked_writer<CharT, Allocator>::default_max_chunk_size;
+
+#endif
+
+using chunked_writer = basic_chunked_writer<char>;
+using u16chunked_writer = basic_chunked_writer<char16_t>;
+using u32chunked_writer = basic_chunked_writer<char32_t>;
+using wchunked_writer = basic_chunked_writer<wchar_t>;
+
+namespace detail {
+
+template <typename CharT, typename Allocator>
+class chunked_writer_creator
+{
+    using params_ = typename strf::basic_chunked_writer<CharT, Allocator>::params;
+
+public:
+
+    using char_type = CharT;
+    using destination_type = strf::basic_chunked_writer<CharT, Allocator>;
+    using sized_destination_type = destination_type;
+    using finish_type = typename destination_type::result;
+
+    explicit chunked_writer_creator(const Allocator& a)
+        : alloc_(a)
+    {
+    }
+
+    chunked_writer_creator(const chunked_writer_creator&) = default;
+
+    params_ create() const
+    {
+        return { destination_type::default_first_chunk_size
+               , destination_type::default_max_chunk_size
+               , alloc_ };
+    }
+
+    // When the size is known in advance, a single chunk is enough
+    params_ create(std::size_t size) const
+    {
+        return {size, destination_type::default_max_chunk_size, alloc_};
+    }
+
+private:
+
+    Allocator alloc_;
+};
+
+} // namespace detail
+
+template <typename CharT = char, typename Allocator = std::allocator<CharT> >
+inline auto to_chunks(const Allocator& a = Allocator())
+    -> strf::destination_no_reserve<strf::detail::chunked_writer_creator<CharT, Allocator>>
+{
+    return strf::destination_no_reserve
+        < strf::detail::chunked_writer_creator<CharT, Allocator> >
+        (a);
+}
+
+} // namespace strf
+
+#endif  // STRF_DETAIL_OUTPUT_TYPES_CHUNKS_HPP
@@ -0,0 +1,261 @@
+#ifndef STRF_DETAIL_OUTPUT_TYPES_FD_HPP
+#define STRF_DETAIL_OUTPUT_TYPES_FD_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <strf.hpp>
+#include <cerrno>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+namespace strf {
+
+namespace detail {
+
+class posix_fd_writer_traits {
+public:
+    posix_fd_writer_traits() = delete;
+    posix_fd_writer_traits(const posix_fd_writer_traits&) = default;
+
+    posix_fd_writer_traits(int fd)
+        : fd_(fd)
+    {
+    }
+
+    ssize_t writev(const struct iovec* iov, int iovcnt) const noexcept {
+        return ::writev(fd_, iov, iovcnt);
+    }
+
+private:
+    int fd_;
+};
+
+struct fd_writer_result {
+    std::size_t count;
+    bool success;
+    int error; // the errno value set by the failed writev call, or zero
+};
+
+// Calls writev until everything is written, since it may write
+// less than requested ( e.g. when the file descriptor is a pipe
+// or a socket ), or be interrupted by a signal. Adds the number of
+// written bytes to count. On failure, sets error to errno.
+template <typename Traits>
+bool fd_write_all
+    ( Traits& traits
+    , struct iovec* iov
+    , int iovcnt
+    , std::size_t& count
+    , int& error ) noexcept
+{
+    while (iovcnt != 0 && iov->iov_len == 0) {
+        ++iov;
+        --iovcnt;
+    }
+    while (iovcnt != 0) {
+        const auto ret = traits.writev(iov, iovcnt);
+        STRF_IF_UNLIKELY (ret <= 0) {
+            if (ret < 0) {
+                const int err = errno;
+                if (err == EINTR) {
+                    continue;
+                }
+                error = err;
+            }
+            return false;
+        }
+        auto n = static_cast<std::size_t>(ret);
+        count += n;
+        while (iovcnt != 0 && n >= iov->iov_len) {
+            n -= iov->iov_len;
+            ++iov;
+            --iovcnt;
+        }
+        if (iovcnt != 0) {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + n;
+            iov->iov_len -= n;
+        }
+    }
+    return true;
+}
+
+// The purpose of the Traits template parameter is to enable the
+// unit tests to simulate partial, interrupted and unsuccessful writings.
+template <typename CharT, typename Traits>
+class fd_writer_base
+    : public strf::destination<CharT>
+{
+    static_assert(noexcept(std::declval<Traits>().writev(nullptr, 0)), "");
+
+public:
+
+    template <typename... TraitsInitArgs>
+    fd_writer_base
+        ( CharT* buff
+        , std::size_t buff_size
+        , TraitsInitArgs&&... args)
+        : strf::destination<CharT>(buff, buff_size)
+        , buff_(buff)
+        , traits_(std::forward<TraitsInitArgs>(args)...)
+    {
+    }
+
+    ~fd_writer_base() {
+        if (this->good()) {
+            flush_buffer_(this->buffer_ptr());
+        }
+    }
+
+    void recycle() noexcept override {
+        auto p = this->buffer_ptr();
+        this->set_buffer_ptr(buff_);
+        STRF_IF_LIKELY (this->good()) {
+            this->set_good(flush_buffer_(p));
+        }
+    }
+
+    using result = strf::detail::fd_writer_result;
+
+    result finish() {
+        bool g = this->good();
+        this->set_good(false);
+        STRF_IF_LIKELY (g) {
+            g = flush_buffer_(this->buffer_ptr());
+        }
+        this->set_buffer_ptr(buff_);
+        return {bytes_count_ / sizeof(CharT), g, error_};
+    }
+
+private:
+
+    // Writes the buffered content and the given string with a single
+    // writev call, instead of copying the string into the buffer.
+    // The string is only borrowed for the duration of this call.
+    void do_write(const CharT* str, std::size_t str_len) noexcept override {
+        auto p = this->buffer_ptr();
+        this->set_buffer_ptr(buff_);
+        STRF_IF_LIKELY (this->good()) {
+            struct iovec iov[2];
+            iov[0].iov_base = static_cast<void*>(buff_);
+            iov[0].iov_len = (p - buff_) * sizeof(CharT);
+            iov[1].iov_base = const_cast<void*>(static_cast<const void*>(str));
+            iov[1].iov_len = str_len * sizeof(CharT);
+            this->set_good(write_all_(iov, 2));
+        }
+    }
+
+    bool flush_buffer_(CharT* p) noexcept {
+        struct iovec iov;
+        iov.iov_base = static_cast<void*>(buff_);
+        iov.iov_len = (p - buff_) * sizeof(CharT);
+        return write_all_(&iov, 1);
+    }
+
+    bool write_all_(struct iovec* iov, int iovcnt) noexcept {
+        return strf::detail::fd_write_all(traits_, iov, iovcnt, bytes_count_, error_);
+    }
+
+    std::size_t bytes_count_ = 0;
+    int error_ = 0;
+    CharT* const buff_;
+    Traits traits_;
+};
+
+} // namespace detail
+
+template <typename CharT, std::size_t BuffSize>
+class fd_writer final
+    : public strf::detail::fd_writer_base
+        < CharT, strf::detail::posix_fd_writer_traits >
+{
+    static_assert(BuffSize >= strf::min_space_after_recycle<CharT>(), "BuffSize too small");
+
+    using impl_ = strf::detail::fd_writer_base
+        < CharT, strf::detail::posix_fd_writer_traits >;
+public:
+
+    explicit fd_writer(int fd)
+        : impl_(buf_, BuffSize, fd)
+    {
+        STRF_ASSERT(fd >= 0);
+    }
+
+    fd_writer() = delete;
+
+    fd_writer(const fd_writer&) = delete;
+    fd_writer(fd_writer&&) = delete;
+
+    ~fd_writer() = default;
+
+    using result = typename impl_::result;
+    using impl_::recycle;
+    using impl_::finish;
+
+private:
+
+    CharT buf_[BuffSize];
+};
+
+namespace detail {
+
+template <typename CharT, std::size_t BuffSize>
+class fd_writer_creator
+{
+public:
+
+    using char_type = CharT;
+    using destination_type = strf::fd_writer<CharT, BuffSize>;
+    using finish_type = typename destination_type::result;
+
+    constexpr fd_writer_creator(int fd) noexcept
+        : fd_(fd)
+    {}
+
+    constexpr fd_writer_creator(const fd_writer_creator&) = default;
+
+    int create() const noexcept
+    {
+        return fd_;
+    }
+
+private:
+    int fd_;
+};
+
+} // namespace detail
+
+template <typename CharT>
+constexpr std::size_t fd_writer_default_buffer_size()
+{
+    return 4096 / sizeof(CharT);
+}
+
+template <typename CharT = char>
+inline auto to_fd(int fd)
+    -> strf::destination_no_reserve
+        < strf::detail::fd_writer_creator
+            < CharT, strf::fd_writer_default_buffer_size<CharT>() > >
+{
+    return strf::destination_no_reserve
+        < strf::detail::fd_writer_creator
+            < CharT, strf::fd_writer_default_buffer_size<CharT>() > >
+        (fd);
+}
+
+// BuffSize is the number of characters of the buffer, which is
+// allocated inside the destination object ( usually on the stack ).
+template <std::size_t BuffSize, typename CharT = char>
+inline auto to_fd(int fd)
+    -> strf::destination_no_reserve<strf::detail::fd_writer_creator<CharT, BuffSize>>
+{
+    return strf::destination_no_reserve
+        < strf::detail::fd_writer_creator<CharT, BuffSize> >
+        (fd);
+}
+
+} // namespace strf
+
+#endif  // STRF_DETAIL_OUTPUT_TYPES_FD_HPP
@@ -0,0 +1,212 @@
+#ifndef STRF_DETAIL_OUTPUT_TYPES_MMAP_FILE_HPP
+#define STRF_DETAIL_OUTPUT_TYPES_MMAP_FILE_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <strf.hpp>
+#include <cerrno>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace strf {
+
+// Writes into a memory-mapped window of the file, so that the printers
+// write directly into the page cache. When the window is full, it is
+// moved forward and the file is extended. finish() truncates the file
+// to the size of the written content.
+//
+// The content is written from the beginning of the file, replacing
+// what was there. The file descriptor must have been opened for
+// reading and writing ( O_RDWR ), which is required by mmap.
+template <typename CharT>
+class mmap_file_writer final: public strf::destination<CharT>
+{
+public:
+
+    static constexpr std::size_t default_window_size = 1 << 20; // in bytes
+
+    struct params {
+        int fd;
+        std::size_t window_size; // in bytes
+    };
+
+    explicit mmap_file_writer(params p) noexcept
+        : mmap_file_writer(p.fd, p.window_size)
+    {
+    }
+
+    explicit mmap_file_writer(int fd, std::size_t window_size = default_window_size) noexcept
+        : strf::destination<CharT>(strf::garbage_buff<CharT>(), strf::garbage_buff_end<CharT>())
+        , fd_(fd)
+    {
+        STRF_ASSERT(fd >= 0);
+        const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const std::size_t min_window_size =
+            page_size + strf::min_space_after_recycle<CharT>() * sizeof(CharT);
+        if (window_size < min_window_size) {
+            window_size = min_window_size;
+        }
+        page_mask_ = ~(page_size - 1);
+        window_size_ = (window_size + page_size - 1) & page_mask_;
+        map_window_(0);
+    }
+
+    mmap_file_writer() = delete;
+    mmap_file_writer(const mmap_file_writer&) = delete;
+    mmap_file_writer(mmap_file_writer&&) = delete;
+
+    ~mmap_file_writer()
+    {
+        if ( ! finished_) {
+            finish();
+        }
+    }
+
+    void recycle() noexcept override
+    {
+        STRF_IF_LIKELY (this->good()) {
+            const std::size_t pos = current_pos_();
+            content_size_ = pos;
+            unmap_window_();
+            map_window_(pos & page_mask_);
+            STRF_IF_LIKELY (this->good()) {
+                this->set_buffer_ptr(window_ptr_() + (pos - window_offset_) / sizeof(CharT));
+            }
+        } else {
+            this->set_buffer_ptr(strf::garbage_buff<CharT>());
+        }
+    }
+
+    struct result {
+        std::size_t count;
+        bool success;
+        int error; // the errno value set by the failed system call, or zero
+    };
+
+    result finish() noexcept
+    {
+        bool g = this->good();
+        if (g) {
+            content_size_ = current_pos_();
+            unmap_window_();
+        }
+        this->set_good(false);
+        this->set_buffer_ptr(strf::garbage_buff<CharT>());
+        this->set_buffer_end(strf::garbage_buff_end<CharT>());
+        if ( ! finished_) {
+            finished_ = true;
+            if (::ftruncate(fd_, static_cast<off_t>(content_size_)) != 0) {
+                g = false;
+                error_ = errno;
+            }
+        }
+        return {content_size_ / sizeof(CharT), g, error_};
+    }
+
+private:
+
+    CharT* window_ptr_() const noexcept
+    {
+        return static_cast<CharT*>(window_);
+    }
+
+    // the position in the file, in bytes, that corresponds to buffer_ptr()
+    std::size_t current_pos_() const noexcept
+    {
+        return window_offset_ + (this->buffer_ptr() - window_ptr_()) * sizeof(CharT);
+    }
+
+    void map_window_(std::size_t offset) noexcept
+    {
+        window_offset_ = offset;
+        if (::ftruncate(fd_, static_cast<off_t>(offset + window_size_)) == 0) {
+            void* p = ::mmap( nullptr, window_size_, PROT_READ | PROT_WRITE
+                            , MAP_SHARED, fd_, static_cast<off_t>(offset) );
+            if (p != MAP_FAILED) {
+                window_ = p;
+                this->set_buffer_ptr(window_ptr_());
+                this->set_buffer_end(window_ptr_() + window_size_ / sizeof(CharT));
+                return;
+            }
+        }
+        error_ = errno;
+        this->set_good(false);
+        this->set_buffer_ptr(strf::garbage_buff<CharT>());
+        this->set_buffer_end(strf::garbage_buff_end<CharT>());
+    }
+
+    void unmap_window_() noexcept
+    {
+        ::munmap(window_, window_size_);
+        window_ = nullptr;
+    }
+
+    int fd_;
+    int error_ = 0;
+    bool finished_ = false;
+    void* window_ = nullptr;
+    std::size_t window_size_ = 0;
+    std::size_t window_offset_ = 0;
+    std::size_t content_size_ = 0;
+    std::size_t page_mask_ = 0;
+};
+
+#if ! defined(__cpp_inline_variables)
+
+template <typename CharT>
+constexpr std::size_t mmap_file_writer<CharT>::default_window_size;
+
+#endif
+
+namespace detail {
+
+template <typename CharT>
+class mmap_file_writer_creator
+{
+public:
+
+    using char_type = CharT;
+    using destination_type = strf::mmap_file_writer<CharT>;
+    using sized_destination_type = strf::mmap_file_writer<CharT>;
+    using finish_type = typename destination_type::result;
+
+    constexpr mmap_file_writer_creator(int fd) noexcept
+        : fd_(fd)
+    {
+    }
+
+    constexpr mmap_file_writer_creator(const mmap_file_writer_creator&) = default;
+
+    typename destination_type::params create() const noexcept
+    {
+        return {fd_, destination_type::default_window_size};
+    }
+
+    // Maps the whole content at once, when its size is known in advance
+    typename destination_type::params create(std::size_t size) const noexcept
+    {
+        return {fd_, size * sizeof(CharT)};
+    }
+
+private:
+    int fd_;
+};
+
+} // namespace detail
+
+template <typename CharT = char>
+inline auto to_mmap_file(int fd)
+    -> strf::destination_no_reserve<strf::detail::mmap_file_writer_creator<CharT>>
+{
+    return strf::destination_no_reserve
+        < strf::detail::mmap_file_writer_creator<CharT> >
+        (fd);
+}
+
+} // namespace strf
+
+#endif  // STRF_DETAIL_OUTPUT_TYPES_MMAP_FILE_HPP
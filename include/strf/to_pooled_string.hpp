@@ -0,0 +1,285 @@
+#ifndef STRF_DETAIL_OUTPUT_TYPES_POOLED_STRING_HPP
+#define STRF_DETAIL_OUTPUT_TYPES_POOLED_STRING_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <strf/to_string.hpp>
+#include <memory>
+
+namespace strf {
+
+// Statistics of the scratch buffer of the current thread
+struct pooled_string_stats {
+    std::size_t calls;     // the number of strings made
+    std::size_t hits;      // how many of them fitted in the scratch buffer without growing it
+    std::size_t grows;     // how many times a scratch buffer was reallocated
+    std::size_t nested;    // strings made while the scratch buffer was already in use
+    std::size_t capacity;  // the current capacity of the scratch buffer, in characters
+};
+
+namespace detail {
+
+template <typename CharT>
+struct string_pool {
+    std::unique_ptr<CharT[]> buff;
+    std::size_t capacity = 0;
+    bool in_use = false;
+    strf::pooled_string_stats stats{0, 0, 0, 0, 0};
+};
+
+template <typename CharT>
+inline strf::detail::string_pool<CharT>& thread_string_pool() noexcept
+{
+    static thread_local strf::detail::string_pool<CharT> pool;
+    return pool;
+}
+
+} // namespace detail
+
+template <typename CharT = char>
+inline strf::pooled_string_stats pooled_string_statistics() noexcept
+{
+    const auto& pool = strf::detail::thread_string_pool<CharT>();
+    auto stats = pool.stats;
+    stats.capacity = pool.capacity;
+    return stats;
+}
+
+template <typename CharT = char>
+inline void reset_pooled_string_statistics() noexcept
+{
+    strf::detail::thread_string_pool<CharT>().stats = {0, 0, 0, 0, 0};
+}
+
+// Frees the scratch buffer of the current thread, unless it is in use
+template <typename CharT = char>
+inline void release_pooled_string_buffer() noexcept
+{
+    auto& pool = strf::detail::thread_string_pool<CharT>();
+    if ( ! pool.in_use) {
+        pool.buff.reset();
+        pool.capacity = 0;
+    }
+}
+
+// Writes into a scratch buffer that is owned by the current thread and
+// reused across calls, and only allocates the resulting string, with
+// the exact size, in finish(). When the content does not fit, the
+// scratch buffer grows, and keeps its new capacity for the next calls,
+// unless it exceeds max_pooled_capacity.
+//
+// If the scratch buffer is already in use by another basic_pooled_string_maker
+// object in the same thread ( e.g. when a printer itself uses
+// to_pooled_string ), a temporary buffer is used instead.
+template < typename CharT
+         , typename Traits = std::char_traits<CharT>
+         , typename Allocator = std::allocator<CharT> >
+class basic_pooled_string_maker final: public strf::destination<CharT>
+{
+    using string_type_ = std::basic_string<CharT, Traits, Allocator>;
+    using pool_type_ = strf::detail::string_pool<CharT>;
+
+public:
+
+    static constexpr std::size_t initial_capacity = 256;
+    static constexpr std::size_t max_pooled_capacity = 64 * 1024;
+
+    basic_pooled_string_maker()
+        : strf::destination<CharT>(nullptr, nullptr)
+        , pool_(strf::detail::thread_string_pool<CharT>())
+    {
+        ++ pool_.stats.calls;
+        if ( ! pool_.in_use) {
+            if (pool_.capacity == 0) {
+                pool_.buff.reset(new CharT[initial_capacity]);
+                pool_.capacity = initial_capacity;
+            }
+            pool_.in_use = true;
+            uses_pool_ = true;
+            set_buffer_(pool_.buff.get(), pool_.capacity);
+        } else {
+            ++ pool_.stats.nested;
+            tmp_buff_.reset(new CharT[initial_capacity]);
+            set_buffer_(tmp_buff_.get(), initial_capacity);
+        }
+    }
+
+    basic_pooled_string_maker(strf::tag<void>)
+        : basic_pooled_string_maker()
+    {
+    }
+
+    basic_pooled_string_maker(const basic_pooled_string_maker&) = delete;
+    basic_pooled_string_maker(basic_pooled_string_maker&&) = delete;
+
+    ~basic_pooled_string_maker()
+    {
+        release_pool_();
+    }
+
+    void recycle() override
+    {
+        STRF_IF_LIKELY (this->good()) {
+            this->set_good(false); // in case the following code throws
+            grow_(strf::min_space_after_recycle<CharT>());
+            this->set_good(true);
+        } else {
+            this->set_buffer_ptr(strf::garbage_buff<CharT>());
+        }
+    }
+
+    string_type_ finish()
+    {
+        bool g = this->good();
+        this->set_good(false);
+        STRF_IF_LIKELY (g) {
+            const std::size_t count = this->buffer_ptr() - buff_;
+            STRF_IF_LIKELY (uses_pool_ && ! grew_) {
+                ++ pool_.stats.hits;
+            }
+            string_type_ str{buff_, count};
+            release_pool_();
+            return str;
+        }
+        release_pool_();
+        return {};
+    }
+
+private:
+
+    void do_write(const CharT* str, std::size_t str_len) override
+    {
+        STRF_IF_LIKELY (this->good()) {
+            this->set_good(false); // in case the following code throws
+            grow_(str_len);
+            strf::detail::copy_n(str, str_len, this->buffer_ptr());
+            this->advance(str_len);
+            this->set_good(true);
+        }
+    }
+
+    void set_buffer_(CharT* buff, std::size_t capacity) noexcept
+    {
+        buff_ = buff;
+        this->set_buffer_ptr(buff);
+        this->set_buffer_end(buff + capacity);
+    }
+
+    // Reallocates the buffer such that it has at least
+    // min_space characters of space after the current content
+    void grow_(std::size_t min_space)
+    {
+        const std::size_t count = this->buffer_ptr() - buff_;
+        const std::size_t capacity = this->buffer_end() - buff_;
+        const std::size_t new_capacity =
+            strf::detail::max(capacity * 2, count + min_space);
+        std::unique_ptr<CharT[]> new_buff{new CharT[new_capacity]};
+        strf::detail::copy_n(buff_, count, new_buff.get());
+        grew_ = true;
+        ++ pool_.stats.grows;
+        if (uses_pool_ && new_capacity <= max_pooled_capacity) {
+            // the scratch buffer keeps the new capacity for the next calls
+            pool_.buff = std::move(new_buff);
+            pool_.capacity = new_capacity;
+            set_buffer_(pool_.buff.get(), new_capacity);
+        } else {
+            tmp_buff_ = std::move(new_buff);
+            set_buffer_(tmp_buff_.get(), new_capacity);
+        }
+        this->advance(count);
+    }
+
+    void release_pool_() noexcept
+    {
+        if (uses_pool_) {
+            uses_pool_ = false;
+            pool_.in_use = false;
+        }
+        tmp_buff_.reset();
+        buff_ = strf::garbage_buff<CharT>();
+        this->set_buffer_ptr(strf::garbage_buff<CharT>());
+        this->set_buffer_end(strf::garbage_buff_end<CharT>());
+    }
+
+    pool_type_& pool_;
+    CharT* buff_ = nullptr;
+    std::unique_ptr<CharT[]> tmp_buff_;
+    bool uses_pool_ = false;
+    bool grew_ = false;
+};
+
+#if ! defined(__cpp_inline_variables)
+
+template <typename CharT, typename Traits, typename Allocator>
+constexpr std::size_t basic_pooled_string_maker<CharT, Traits, Allocator>::initial_capacity;
+
+template <typename CharT, typename Traits, typename Allocator>
+constexpr std::size_t basic_pooled_string_maker<CharT, Traits, Allocator>::max_pooled_capacity;
+
+#endif
+
+using pooled_string_maker = basic_pooled_string_maker<char>;
+using pooled_u16string_maker = basic_pooled_string_maker<char16_t>;
+using pooled_u32string_maker = basic_pooled_string_maker<char32_t>;
+using pooled_wstring_maker = basic_pooled_string_maker<wchar_t>;
+
+namespace detail {
+
+template < typename CharT
+         , typename Traits = std::char_traits<CharT>
+         , typename Allocator = std::allocator<CharT> >
+class basic_pooled_string_maker_creator
+{
+public:
+
+    using char_type = CharT;
+    using finish_type = std::basic_string<CharT, Traits, Allocator>;
+    using destination_type = strf::basic_pooled_string_maker<CharT, Traits, Allocator>;
+    // When the size is known in advance, the string can be written directly
+    using sized_destination_type = strf::basic_sized_string_maker<CharT, Traits, Allocator>;
+
+    strf::tag<void> create() const noexcept
+    {
+        return strf::tag<void>{};
+    }
+    std::size_t create(std::size_t size) const noexcept
+    {
+        return size;
+    }
+};
+
+} // namespace detail
+
+#if defined(STRF_HAS_VARIABLE_TEMPLATES)
+
+template< typename CharT
+        , typename Traits = std::char_traits<CharT>
+        , typename Allocator = std::allocator<CharT> >
+constexpr strf::destination_no_reserve
+    < strf::detail::basic_pooled_string_maker_creator<CharT, Traits, Allocator> >
+    to_basic_pooled_string{};
+
+#endif // defined(STRF_HAS_VARIABLE_TEMPLATES)
+
+constexpr strf::destination_no_reserve
+    < strf::detail::basic_pooled_string_maker_creator<char> >
+    to_pooled_string{};
+
+constexpr strf::destination_no_reserve
+    < strf::detail::basic_pooled_string_maker_creator<char16_t> >
+    to_pooled_u16string{};
+
+constexpr strf::destination_no_reserve
+    < strf::detail::basic_pooled_string_maker_creator<char32_t> >
+    to_pooled_u32string{};
+
+constexpr strf::destination_no_reserve
+    < strf::detail::basic_pooled_string_maker_creator<wchar_t> >
+    to_pooled_wstring{};
+
+} // namespace strf
+
+#endif  // STRF_DETAIL_OUTPUT_TYPES_POOLED_STRING_HPP
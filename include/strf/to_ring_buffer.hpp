@@ -0,0 +1,440 @@
+#ifndef STRF_DETAIL_OUTPUT_TYPES_RING_BUFFER_HPP
+#define STRF_DETAIL_OUTPUT_TYPES_RING_BUFFER_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <strf.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#if ! defined(_WIN32)
+#  include <strf/to_fd.hpp>
+#endif
+
+namespace strf {
+
+class ring_buffer_writer;
+
+// A bounded byte ring shared by many producer threads and one consumer
+// thread. Each producer reserves a slot for a record with a single
+// atomic compare-and-swap on the head position, writes the record
+// directly into the slot, and then commits it. The consumer reads the
+// committed records in the order their slots were reserved: it stops
+// at the first record that is not committed yet.
+//
+// Each slot starts with an 8 bytes header. A record never wraps around
+// the end of the ring: when it would, a padding slot is reserved
+// together with it, filling the rest of the ring.
+class ring_buffer
+{
+public:
+
+    static constexpr std::size_t default_record_capacity = 256;
+
+    // The capacity is rounded up to a power of two
+    explicit ring_buffer(std::size_t min_capacity)
+        : capacity_(round_capacity_(min_capacity))
+        , mask_(capacity_ - 1)
+        , mem_(new std::uint64_t[capacity_ / sizeof(std::uint64_t)]())
+    {
+    }
+
+    ring_buffer(const ring_buffer&) = delete;
+    ring_buffer& operator=(const ring_buffer&) = delete;
+
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    // The maximum number of bytes of a record
+    std::size_t max_record_size() const noexcept
+    {
+        return capacity_ / 4 - header_size_;
+    }
+
+    // The number of records that were dropped because the ring was full
+    std::size_t dropped_count() const noexcept
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    // Calls f(const char* data, std::size_t size) for each committed
+    // record, and then releases their slots. Must not be called
+    // concurrently with another call to consume or drain_to_fd.
+    // Returns the number of consumed records.
+    template <typename Func>
+    std::size_t consume(Func f)
+    {
+        const std::uint64_t begin = tail_.load(std::memory_order_relaxed);
+        const std::uint64_t head = head_.load(std::memory_order_acquire);
+        std::uint64_t pos = begin;
+        std::size_t count = 0;
+        // not pos != head, because commit_ may have moved head_
+        // backwards, and then new slots may start before head
+        while (pos < head) {
+            const std::uint32_t state = state_at_(pos).load(std::memory_order_acquire);
+            if ( ! (state & committed_flag_)) {
+                break;
+            }
+            if ( ! (state & padding_flag_)) {
+                f(static_cast<const char*>(data_at_(pos)), std::size_t{state >> 2});
+                ++count;
+            }
+            pos += slot_size_at_(pos);
+        }
+        release_(begin, pos);
+        return count;
+    }
+
+#if ! defined(_WIN32)
+
+    struct drain_result {
+        std::size_t records;
+        std::size_t bytes;
+        bool success;
+        int error; // the errno value set by the failed writev call, or zero
+    };
+
+    // Writes the committed records into the file descriptor, with as
+    // few writev calls as possible, and then releases their slots.
+    // The slots are released even if writev fails. Must not be called
+    // concurrently with another call to consume or drain_to_fd.
+    drain_result drain_to_fd(int fd) noexcept
+    {
+        constexpr int max_iovcnt = 64;
+        strf::detail::posix_fd_writer_traits traits{fd};
+        drain_result r{0, 0, true, 0};
+        for (;;) {
+            const std::uint64_t begin = tail_.load(std::memory_order_relaxed);
+            const std::uint64_t head = head_.load(std::memory_order_acquire);
+            std::uint64_t pos = begin;
+            struct iovec iov[max_iovcnt];
+            int iovcnt = 0;
+            while (pos < head && iovcnt < max_iovcnt) { // see consume
+                const std::uint32_t state = state_at_(pos).load(std::memory_order_acquire);
+                if ( ! (state & committed_flag_)) {
+                    break;
+                }
+                if ( ! (state & padding_flag_)) {
+                    iov[iovcnt].iov_base = data_at_(pos);
+                    iov[iovcnt].iov_len = state >> 2;
+                    ++iovcnt;
+                    ++r.records;
+                }
+                pos += slot_size_at_(pos);
+            }
+            if (pos == begin) {
+                return r;
+            }
+            if (r.success) {
+                r.success = strf::detail::fd_write_all(traits, iov, iovcnt, r.bytes, r.error);
+            }
+            release_(begin, pos);
+        }
+    }
+
+#endif // ! defined(_WIN32)
+
+private:
+
+    friend class strf::ring_buffer_writer;
+
+    static constexpr std::size_t header_size_ = 8;
+    static constexpr std::uint32_t committed_flag_ = 1;
+    static constexpr std::uint32_t padding_flag_ = 2;
+
+    static std::size_t round_capacity_(std::size_t min_capacity) noexcept
+    {
+        std::size_t c = 1024;
+        while (c < min_capacity && c < (std::size_t{1} << 31)) {
+            c <<= 1;
+        }
+        return c;
+    }
+    static std::size_t slot_size_(std::size_t record_capacity) noexcept
+    {
+        return header_size_ + ((record_capacity + 7) & ~std::size_t{7});
+    }
+
+    // The header of each slot contains a 32 bits state, which is zero
+    // until the slot is committed, followed by the size of the slot.
+    std::atomic<std::uint32_t>& state_at_(std::uint64_t pos) noexcept
+    {
+        static_assert(sizeof(std::atomic<std::uint32_t>) == 4, "");
+        void* p = &mem_[(pos & mask_) / sizeof(std::uint64_t)];
+        return *static_cast<std::atomic<std::uint32_t>*>(p);
+    }
+    std::uint32_t& slot_size_at_(std::uint64_t pos) noexcept
+    {
+        void* p = &mem_[(pos & mask_) / sizeof(std::uint64_t)];
+        return static_cast<std::uint32_t*>(p)[1];
+    }
+    void* data_at_(std::uint64_t pos) noexcept
+    {
+        return &mem_[(pos & mask_) / sizeof(std::uint64_t) + 1];
+    }
+
+    // Reserves a slot for a record of record_capacity bytes.
+    // Returns false if there is not enough free space.
+    bool reserve_(std::size_t record_capacity, std::uint64_t& pos) noexcept
+    {
+        const std::size_t size = slot_size_(record_capacity);
+        // acquire, because the memory may have been given back by commit_
+        std::uint64_t head = head_.load(std::memory_order_acquire);
+        for (;;) {
+            const std::size_t offset = head & mask_;
+            const std::size_t padding = offset + size > capacity_ ? capacity_ - offset : 0;
+            const std::uint64_t tail = tail_.load(std::memory_order_acquire);
+            STRF_IF_UNLIKELY (head + padding + size - tail > capacity_) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (head_.compare_exchange_weak( head, head + padding + size
+                                           , std::memory_order_acquire )) {
+                if (padding) {
+                    slot_size_at_(head) = static_cast<std::uint32_t>(padding);
+                    state_at_(head).store( committed_flag_ | padding_flag_
+                                         , std::memory_order_release );
+                }
+                pos = head + padding;
+                return true;
+            }
+        }
+    }
+
+    // Enlarges the slot at pos, which only succeeds if no other slot
+    // has been reserved after it and it does not need to wrap around.
+    bool try_extend_
+        ( std::uint64_t pos
+        , std::size_t old_capacity
+        , std::size_t new_capacity ) noexcept
+    {
+        const std::size_t new_size = slot_size_(new_capacity);
+        if ((pos & mask_) + new_size > capacity_) {
+            return false;
+        }
+        const std::uint64_t new_end = pos + new_size;
+        if (new_end - tail_.load(std::memory_order_acquire) > capacity_) {
+            return false;
+        }
+        std::uint64_t old_end = pos + slot_size_(old_capacity);
+        return head_.compare_exchange_strong(old_end, new_end, std::memory_order_acquire);
+    }
+
+    // Commits the record. If no other slot has been reserved after this
+    // one, the unused part of the slot is given back to the ring.
+    void commit_(std::uint64_t pos, std::size_t record_capacity, std::size_t size) noexcept
+    {
+        std::size_t slot_size = slot_size_(record_capacity);
+        const std::size_t used_slot_size = slot_size_(size);
+        if (used_slot_size < slot_size) {
+            std::uint64_t end = pos + slot_size;
+            const std::uint64_t used_end = pos + used_slot_size;
+            // the printers may have written anything in the unused part
+            char* const mem = reinterpret_cast<char*>(mem_.get());
+            std::memset(mem + (used_end & mask_), 0, slot_size - used_slot_size);
+            if (head_.compare_exchange_strong(end, used_end, std::memory_order_release)) {
+                slot_size = used_slot_size;
+            }
+        }
+        slot_size_at_(pos) = static_cast<std::uint32_t>(slot_size);
+        const auto state = (static_cast<std::uint32_t>(size) << 2) | committed_flag_;
+        state_at_(pos).store(state, std::memory_order_release);
+    }
+
+    // Zeroes the consumed slots, so that their memory can
+    // be reused, and then makes it available to the producers
+    void release_(std::uint64_t begin, std::uint64_t end) noexcept
+    {
+        if (begin == end) {
+            return;
+        }
+        const std::size_t offset = begin & mask_;
+        const std::size_t size = end - begin;
+        char* const mem = reinterpret_cast<char*>(mem_.get());
+        if (offset + size <= capacity_) {
+            std::memset(mem + offset, 0, size);
+        } else {
+            std::memset(mem + offset, 0, capacity_ - offset);
+            std::memset(mem, 0, offset + size - capacity_);
+        }
+        tail_.store(end, std::memory_order_release);
+    }
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<std::uint64_t[]> mem_;
+
+    // head_ is modified by the producers and tail_ by the consumer.
+    // They are kept in separate cache lines.
+    char padding0_[64];
+    std::atomic<std::uint64_t> head_{0};
+    char padding1_[64];
+    std::atomic<std::uint64_t> tail_{0};
+    char padding2_[64];
+    std::atomic<std::size_t> dropped_{0};
+};
+
+#if ! defined(__cpp_inline_variables)
+
+constexpr std::size_t ring_buffer::default_record_capacity;
+constexpr std::size_t ring_buffer::header_size_;
+constexpr std::uint32_t ring_buffer::committed_flag_;
+constexpr std::uint32_t ring_buffer::padding_flag_;
+
+#endif
+
+// Writes a record directly into a slot of a ring_buffer. If the record
+// does not fit in the slot, recycle() tries to enlarge it, which only
+// succeeds if no other slot was reserved after it in the meanwhile.
+// Otherwise, the record is truncated. If the ring is full, the record
+// is dropped. finish() commits the record.
+class ring_buffer_writer final: public strf::destination<char>
+{
+public:
+
+    struct params {
+        strf::ring_buffer& ring;
+        std::size_t record_capacity;
+    };
+
+    explicit ring_buffer_writer(strf::ring_buffer& ring) noexcept
+        : ring_buffer_writer(ring, strf::ring_buffer::default_record_capacity)
+    {
+    }
+
+    explicit ring_buffer_writer(params p) noexcept
+        : ring_buffer_writer(p.ring, p.record_capacity)
+    {
+    }
+
+    ring_buffer_writer(strf::ring_buffer& ring, std::size_t record_capacity) noexcept
+        : strf::destination<char>(strf::garbage_buff<char>(), strf::garbage_buff_end<char>())
+        , ring_(ring)
+        , capacity_(strf::detail::min(record_capacity, ring.max_record_size()))
+    {
+        reserved_ = ring_.reserve_(capacity_, pos_);
+        STRF_IF_LIKELY (reserved_) {
+            data_ = static_cast<char*>(ring_.data_at_(pos_));
+            this->set_buffer_ptr(data_);
+            this->set_buffer_end(data_ + capacity_);
+        } else {
+            this->set_good(false);
+        }
+    }
+
+    ring_buffer_writer(const ring_buffer_writer&) = delete;
+    ring_buffer_writer(ring_buffer_writer&&) = delete;
+
+    ~ring_buffer_writer()
+    {
+        // an uncommitted slot would block the consumer forever
+        finish();
+    }
+
+    void recycle() noexcept override
+    {
+        STRF_IF_LIKELY (this->good()) {
+            const std::size_t size = this->buffer_ptr() - data_;
+            const std::size_t new_capacity = strf::detail::min
+                ( strf::detail::max
+                    (capacity_ * 2, size + strf::min_space_after_recycle<char>())
+                , ring_.max_record_size() );
+            if ( new_capacity > capacity_
+              && ring_.try_extend_(pos_, capacity_, new_capacity) ) {
+                capacity_ = new_capacity;
+                this->set_buffer_end(data_ + capacity_);
+                return;
+            }
+            size_ = size;
+            truncated_ = true;
+            this->set_good(false);
+        }
+        this->set_buffer_ptr(strf::garbage_buff<char>());
+        this->set_buffer_end(strf::garbage_buff_end<char>());
+    }
+
+    struct result {
+        std::size_t count;
+        bool success;   // false if the record was dropped or truncated
+        bool truncated;
+    };
+
+    result finish() noexcept
+    {
+        STRF_IF_LIKELY (this->good()) {
+            size_ = this->buffer_ptr() - data_;
+        }
+        this->set_good(false);
+        this->set_buffer_ptr(strf::garbage_buff<char>());
+        this->set_buffer_end(strf::garbage_buff_end<char>());
+        const bool success = reserved_ && ! truncated_;
+        if ( ! committed_ && reserved_) {
+            committed_ = true;
+            ring_.commit_(pos_, capacity_, size_);
+        }
+        return {size_, success, truncated_};
+    }
+
+private:
+
+    strf::ring_buffer& ring_;
+    std::size_t capacity_;
+    std::size_t size_ = 0;
+    std::uint64_t pos_ = 0;
+    char* data_ = nullptr;
+    bool reserved_ = false;
+    bool committed_ = false;
+    bool truncated_ = false;
+};
+
+namespace detail {
+
+class ring_buffer_writer_creator
+{
+public:
+
+    using char_type = char;
+    using destination_type = strf::ring_buffer_writer;
+    using sized_destination_type = strf::ring_buffer_writer;
+    using finish_type = destination_type::result;
+
+    constexpr ring_buffer_writer_creator(strf::ring_buffer& ring) noexcept
+        : ring_(ring)
+    {
+    }
+
+    constexpr ring_buffer_writer_creator(const ring_buffer_writer_creator&) = default;
+
+    strf::ring_buffer& create() const noexcept
+    {
+        return ring_;
+    }
+
+    // Reserves a slot of the exact size, when it is known in advance
+    destination_type::params create(std::size_t size) const noexcept
+    {
+        return {ring_, size};
+    }
+
+private:
+
+    strf::ring_buffer& ring_;
+};
+
+} // namespace detail
+
+inline auto to(strf::ring_buffer& ring)
+    -> strf::destination_no_reserve<strf::detail::ring_buffer_writer_creator>
+{
+    return strf::destination_no_reserve<strf::detail::ring_buffer_writer_creator>(ring);
+}
+
+} // namespace strf
+
+#endif  // STRF_DETAIL_OUTPUT_TYPES_RING_BUFFER_HPP
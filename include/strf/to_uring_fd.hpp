@@ -0,0 +1,654 @@
+#ifndef STRF_DETAIL_OUTPUT_TYPES_URING_FD_HPP
+#define STRF_DETAIL_OUTPUT_TYPES_URING_FD_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <strf/to_fd.hpp>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <fcntl.h>
+#include <unistd.h>
+
+// io_uring is used through raw system calls, so that liburing is not
+// required. It is detected at compile-time, and can be disabled by
+// defining STRF_NO_IO_URING. When the kernel does not support it
+// ( or forbids it ), uring_fd_writer falls back to writev(2).
+
+#if ! defined(STRF_NO_IO_URING) && defined(__linux__) && defined(__has_include)
+#  if __has_include(<linux/io_uring.h>)
+#    include <linux/io_uring.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) \
+     && defined(IORING_FEAT_RW_CUR_POS)
+#      define STRF_HAS_IO_URING
+#    endif
+#  endif
+#endif
+
+namespace strf {
+
+namespace detail {
+
+#if defined(STRF_HAS_IO_URING)
+
+// A minimal io_uring instance, only able to submit write requests
+class io_uring_queue {
+public:
+
+    io_uring_queue() = default;
+    io_uring_queue(const io_uring_queue&) = delete;
+
+    ~io_uring_queue()
+    {
+        if (ring_fd_ >= 0) {
+            ::munmap(sqes_, sqes_size_);
+            if (cq_ring_ != sq_ring_) {
+                ::munmap(cq_ring_, cq_ring_size_);
+            }
+            ::munmap(sq_ring_, sq_ring_size_);
+            ::close(ring_fd_);
+        }
+    }
+
+    // Requires kernel 5.6 or newer, which supports IORING_OP_WRITE
+    // and the offset -1 as the current file position.
+    bool setup(unsigned entries) noexcept
+    {
+        struct io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+        const long fd = ::syscall(__NR_io_uring_setup, entries, &p);
+        if (fd < 0) {
+            return false;
+        }
+        ring_fd_ = static_cast<int>(fd);
+        if ( ! (p.features & IORING_FEAT_RW_CUR_POS)) {
+            ::close(ring_fd_);
+            ring_fd_ = -1;
+            return false;
+        }
+        sq_ring_size_ = p.sq_off.array + p.sq_entries * sizeof(std::uint32_t);
+        cq_ring_size_ = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+        sqes_size_ = p.sq_entries * sizeof(struct io_uring_sqe);
+        const bool single_mmap = p.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) {
+            sq_ring_size_ = cq_ring_size_ = strf::detail::max(sq_ring_size_, cq_ring_size_);
+        }
+        sq_ring_ = map_(sq_ring_size_, IORING_OFF_SQ_RING);
+        cq_ring_ = single_mmap ? sq_ring_ : map_(cq_ring_size_, IORING_OFF_CQ_RING);
+        sqes_ = map_(sqes_size_, IORING_OFF_SQES);
+        if (sq_ring_ == MAP_FAILED || cq_ring_ == MAP_FAILED || sqes_ == MAP_FAILED) {
+            if (sqes_ != MAP_FAILED) {
+                ::munmap(sqes_, sqes_size_);
+            }
+            if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_) {
+                ::munmap(cq_ring_, cq_ring_size_);
+            }
+            if (sq_ring_ != MAP_FAILED) {
+                ::munmap(sq_ring_, sq_ring_size_);
+            }
+            ::close(ring_fd_);
+            ring_fd_ = -1;
+            return false;
+        }
+        auto* sq = static_cast<char*>(sq_ring_);
+        auto* cq = static_cast<char*>(cq_ring_);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + p.cq_off.cqes);
+        return true;
+    }
+
+    // Queues a write request and submits it, together with any
+    // request whose submission was previously postponed by the kernel.
+    // On failure, the request is discarded and errno is set.
+    bool submit_write
+        ( int fd
+        , const void* ptr
+        , std::size_t len
+        , std::int64_t offset
+        , std::uint64_t user_data ) noexcept
+    {
+        const unsigned tail = *sq_tail_;
+        const unsigned index = tail & sq_mask_;
+        struct io_uring_sqe* sqe = static_cast<struct io_uring_sqe*>(sqes_) + index;
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_WRITE;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<std::uintptr_t>(ptr);
+        sqe->len = static_cast<std::uint32_t>(len);
+        sqe->off = static_cast<std::uint64_t>(offset);
+        sqe->user_data = user_data;
+        sq_array_[index] = index;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+        ++ unsubmitted_;
+        if (enter_(0) < 0) {
+            const int err = errno;
+            if (err != EINTR && err != EAGAIN && err != EBUSY) {
+                // The kernel only reads the tail in io_uring_enter
+                __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+                -- unsubmitted_;
+                return false;
+            }
+            // otherwise, it is submitted in the next io_uring_enter call
+        }
+        return true;
+    }
+
+    // Waits until a request completes. Returns false and sets
+    // errno if io_uring_enter fails.
+    bool wait_completion(std::uint64_t& user_data, int& res) noexcept
+    {
+        for (;;) {
+            const unsigned head = *cq_head_;
+            if (head != __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+                const struct io_uring_cqe& cqe = cqes_[head & cq_mask_];
+                user_data = cqe.user_data;
+                res = cqe.res;
+                __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+                return true;
+            }
+            if (enter_(1) < 0) {
+                const int err = errno;
+                if (err != EINTR && err != EAGAIN && err != EBUSY) {
+                    return false;
+                }
+            }
+        }
+    }
+
+private:
+
+    void* map_(std::size_t size, unsigned long long offset) noexcept
+    {
+        return ::mmap( nullptr, size, PROT_READ | PROT_WRITE
+                     , MAP_SHARED | MAP_POPULATE, ring_fd_
+                     , static_cast<off_t>(offset) );
+    }
+
+    long enter_(unsigned min_complete) noexcept
+    {
+        const unsigned flags = min_complete != 0 ? IORING_ENTER_GETEVENTS : 0;
+        const long ret = ::syscall
+            ( __NR_io_uring_enter, ring_fd_, unsubmitted_, min_complete
+            , flags, nullptr, 0 );
+        if (ret > 0) {
+            unsubmitted_ -= static_cast<unsigned>(ret);
+        }
+        return ret;
+    }
+
+    int ring_fd_ = -1;
+    unsigned unsubmitted_ = 0;
+
+    void* sq_ring_ = MAP_FAILED;
+    void* cq_ring_ = MAP_FAILED;
+    void* sqes_ = MAP_FAILED;
+    std::size_t sq_ring_size_ = 0;
+    std::size_t cq_ring_size_ = 0;
+    std::size_t sqes_size_ = 0;
+
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    struct io_uring_cqe* cqes_ = nullptr;
+};
+
+#endif // defined(STRF_HAS_IO_URING)
+
+class uring_fd_writer_traits {
+public:
+    uring_fd_writer_traits() = delete;
+    uring_fd_writer_traits(const uring_fd_writer_traits&) = delete;
+
+    uring_fd_writer_traits(int fd)
+        : fd_(fd)
+    {
+    }
+
+    // Returns false if io_uring is not available
+    bool setup(unsigned entries) noexcept {
+#if defined(STRF_HAS_IO_URING)
+        return ring_.setup(entries);
+#else
+        (void) entries;
+        return false;
+#endif
+    }
+
+    // Returns the current file position, or -1 if the writings
+    // can not be done at explicit offsets ( e.g. pipes, sockets
+    // and files opened with O_APPEND ), in which case they need
+    // to be done one at a time.
+    std::int64_t start_offset() noexcept {
+        const int flags = ::fcntl(fd_, F_GETFL);
+        if (flags < 0 || (flags & O_APPEND)) {
+            return -1;
+        }
+        return ::lseek(fd_, 0, SEEK_CUR);
+    }
+
+    bool set_offset(std::int64_t offset) noexcept {
+        return ::lseek(fd_, static_cast<off_t>(offset), SEEK_SET) >= 0;
+    }
+
+#if defined(STRF_HAS_IO_URING)
+
+    bool submit_write
+        ( const void* ptr, std::size_t len
+        , std::int64_t offset, std::uint64_t user_data ) noexcept
+    {
+        return ring_.submit_write(fd_, ptr, len, offset, user_data);
+    }
+
+    bool wait_completion(std::uint64_t& user_data, int& res) noexcept {
+        return ring_.wait_completion(user_data, res);
+    }
+
+#else
+
+    bool submit_write(const void*, std::size_t, std::int64_t, std::uint64_t) noexcept {
+        errno = ENOSYS;
+        return false;
+    }
+
+    bool wait_completion(std::uint64_t&, int&) noexcept {
+        errno = ENOSYS;
+        return false;
+    }
+
+#endif // defined(STRF_HAS_IO_URING)
+
+    // used when io_uring is not available
+    ssize_t writev(const struct iovec* iov, int iovcnt) const noexcept {
+        return ::writev(fd_, iov, iovcnt);
+    }
+
+private:
+    int fd_;
+#if defined(STRF_HAS_IO_URING)
+    strf::detail::io_uring_queue ring_;
+#endif
+};
+
+// Each buffer, once full, is submitted as an io_uring write request,
+// and the writer continues into another buffer of a small pool. A
+// buffer returns to the pool when its request completes. So formatting
+// and writing overlap without a helper thread. When all buffers are
+// in flight, recycle() waits for the first completion.
+//
+// When the fd is seekable, each request carries an explicit offset, so
+// that the kernel may complete them in any order, and finish() moves
+// the file position to the end of the written content. Otherwise, the
+// requests are done one at a time.
+//
+// When io_uring is not available, it behaves like fd_writer.
+//
+// The purpose of the Traits template parameter is to enable the
+// unit tests to simulate partial, out-of-order and unsuccessful writings.
+template <typename CharT, typename Traits>
+class uring_fd_writer_base
+    : public strf::destination<CharT>
+{
+    static_assert(noexcept(std::declval<Traits>().writev(nullptr, 0)), "");
+
+public:
+
+    template <typename... TraitsInitArgs>
+    uring_fd_writer_base
+        ( std::size_t buffer_size
+        , std::size_t buffers_count
+        , TraitsInitArgs&&... args )
+        : strf::destination<CharT>(nullptr, nullptr)
+        , buffer_size_(strf::detail::max(buffer_size, strf::min_space_after_recycle<CharT>()))
+        , traits_(std::forward<TraitsInitArgs>(args)...)
+    {
+        buffers_count = strf::detail::max(buffers_count, std::size_t{2});
+        uses_io_uring_ = traits_.setup(static_cast<unsigned>(buffers_count));
+        if (uses_io_uring_) {
+            offset_ = traits_.start_offset();
+            sequenced_ = offset_ < 0;
+        } else {
+            buffers_count = 1;
+        }
+        buffers_.reset(new CharT[buffer_size_ * buffers_count]);
+        requests_.reset(new request_[buffers_count]);
+        free_buffers_.reset(new std::size_t[buffers_count]);
+        for (std::size_t i = 1; i < buffers_count; ++i) {
+            free_buffers_[free_count_++] = i;
+        }
+        set_buffer_(0);
+    }
+
+    uring_fd_writer_base(const uring_fd_writer_base&) = delete;
+    uring_fd_writer_base(uring_fd_writer_base&&) = delete;
+
+    ~uring_fd_writer_base()
+    {
+        if (this->good()) {
+            flush_(this->buffer_ptr());
+            if (complete_all_()) {
+                update_file_position_();
+            }
+        } else {
+            complete_all_();
+        }
+        if (broken_) {
+            // the kernel may still be reading them
+            buffers_.release(); // NOLINT(bugprone-unused-return-value)
+        }
+    }
+
+    void recycle() noexcept override
+    {
+        STRF_IF_LIKELY (this->good()) {
+            STRF_IF_LIKELY (flush_(this->buffer_ptr()) && next_buffer_()) {
+                return;
+            }
+            this->set_good(false);
+        }
+        this->set_buffer_ptr(strf::garbage_buff<CharT>());
+        this->set_buffer_end(strf::garbage_buff_end<CharT>());
+    }
+
+    using result = strf::detail::fd_writer_result;
+
+    result finish() noexcept
+    {
+        bool g = this->good();
+        this->set_good(false);
+        STRF_IF_LIKELY (g) {
+            g = flush_(this->buffer_ptr());
+        }
+        this->set_buffer_ptr(strf::garbage_buff<CharT>());
+        this->set_buffer_end(strf::garbage_buff_end<CharT>());
+        g = complete_all_() && g && ! failed_;
+        if (g && ! update_file_position_()) {
+            g = false;
+            error_ = errno;
+        }
+        return {bytes_count_ / sizeof(CharT), g, error_};
+    }
+
+    bool uses_io_uring() const noexcept
+    {
+        return uses_io_uring_;
+    }
+
+private:
+
+    struct request_ {
+        const char* ptr;
+        std::size_t len;
+        std::int64_t offset;
+    };
+
+    void set_buffer_(std::size_t index) noexcept
+    {
+        buff_index_ = index;
+        CharT* buff = buffers_.get() + index * buffer_size_;
+        this->set_buffer_ptr(buff);
+        this->set_buffer_end(buff + buffer_size_);
+    }
+
+    const CharT* buffer_begin_() const noexcept
+    {
+        return buffers_.get() + buff_index_ * buffer_size_;
+    }
+
+    // Submits ( or writes, when io_uring is not available )
+    // the content of the current buffer
+    bool flush_(const CharT* end) noexcept
+    {
+        const CharT* begin = buffer_begin_();
+        const std::size_t len = static_cast<std::size_t>(end - begin) * sizeof(CharT);
+        if ( ! uses_io_uring_) {
+            struct iovec iov;
+            iov.iov_base = const_cast<void*>(static_cast<const void*>(begin));
+            iov.iov_len = len;
+            return strf::detail::fd_write_all(traits_, &iov, 1, bytes_count_, error_);
+        }
+        if (len == 0) {
+            free_buffers_[free_count_++] = buff_index_;
+            return true;
+        }
+        while (sequenced_ && in_flight_ != 0) {
+            if ( ! complete_one_()) {
+                return false;
+            }
+        }
+        request_& req = requests_[buff_index_];
+        req.ptr = reinterpret_cast<const char*>(begin);
+        req.len = len;
+        req.offset = offset_;
+        if ( ! sequenced_) {
+            offset_ += static_cast<std::int64_t>(len);
+        }
+        ++ in_flight_;
+        submit_(buff_index_);
+        return ! failed_;
+    }
+
+    // Since the requests are done at explicit offsets, the file
+    // position needs to be moved as if write(2) were used.
+    bool update_file_position_() noexcept
+    {
+        return ! uses_io_uring_ || sequenced_ || traits_.set_offset(offset_);
+    }
+
+    bool next_buffer_() noexcept
+    {
+        if (uses_io_uring_) {
+            while (free_count_ == 0) {
+                if ( ! complete_one_()) {
+                    return false;
+                }
+            }
+            set_buffer_(free_buffers_[--free_count_]);
+            return ! failed_;
+        }
+        set_buffer_(0);
+        return true;
+    }
+
+    void submit_(std::size_t index) noexcept
+    {
+        const request_& req = requests_[index];
+        if ( ! traits_.submit_write(req.ptr, req.len, req.offset, index)) {
+            fail_(errno);
+            release_(index);
+        }
+    }
+
+    void release_(std::size_t index) noexcept
+    {
+        -- in_flight_;
+        free_buffers_[free_count_++] = index;
+    }
+
+    void fail_(int err) noexcept
+    {
+        if ( ! failed_) {
+            failed_ = true;
+            error_ = err;
+        }
+    }
+
+    // Waits for one completion, and resubmits the remaining
+    // part of the request if it was partially written.
+    bool complete_one_() noexcept
+    {
+        std::uint64_t user_data = 0;
+        int res = 0;
+        if ( ! traits_.wait_completion(user_data, res)) {
+            fail_(errno);
+            broken_ = true;
+            return false;
+        }
+        const auto index = static_cast<std::size_t>(user_data);
+        request_& req = requests_[index];
+        if (res < 0) {
+            if (res == -EINTR || res == -EAGAIN) {
+                submit_(index);
+            } else {
+                fail_(-res);
+                release_(index);
+            }
+        } else if (res == 0) {
+            fail_(0);
+            release_(index);
+        } else {
+            const auto n = static_cast<std::size_t>(res);
+            bytes_count_ += n;
+            if (n < req.len) {
+                req.ptr += n;
+                req.len -= n;
+                if (req.offset >= 0) {
+                    req.offset += res;
+                }
+                submit_(index);
+            } else {
+                release_(index);
+            }
+        }
+        return true;
+    }
+
+    bool complete_all_() noexcept
+    {
+        while (in_flight_ != 0) {
+            if ( ! complete_one_()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const std::size_t buffer_size_;
+    std::unique_ptr<CharT[]> buffers_;
+    std::unique_ptr<request_[]> requests_;
+    std::unique_ptr<std::size_t[]> free_buffers_;
+    std::size_t free_count_ = 0;
+    std::size_t buff_index_ = 0;
+    std::size_t in_flight_ = 0;
+
+    std::int64_t offset_ = -1;
+    std::size_t bytes_count_ = 0;
+    int error_ = 0;
+    bool uses_io_uring_ = false;
+    bool sequenced_ = true;
+    bool failed_ = false;
+    bool broken_ = false;
+
+    Traits traits_;
+};
+
+} // namespace detail
+
+template <typename CharT>
+class uring_fd_writer final
+    : public strf::detail::uring_fd_writer_base
+        < CharT, strf::detail::uring_fd_writer_traits >
+{
+    using impl_ = strf::detail::uring_fd_writer_base
+        < CharT, strf::detail::uring_fd_writer_traits >;
+public:
+
+    static constexpr std::size_t default_buffer_size = 65536 / sizeof(CharT);
+    static constexpr std::size_t default_buffers_count = 4;
+
+    struct params {
+        int fd;
+        std::size_t buffer_size;   // in characters
+        std::size_t buffers_count;
+    };
+
+    explicit uring_fd_writer(params p)
+        : uring_fd_writer(p.fd, p.buffer_size, p.buffers_count)
+    {
+    }
+
+    explicit uring_fd_writer
+        ( int fd
+        , std::size_t buffer_size = default_buffer_size
+        , std::size_t buffers_count = default_buffers_count )
+        : impl_(buffer_size, buffers_count, fd)
+    {
+        STRF_ASSERT(fd >= 0);
+    }
+
+    uring_fd_writer() = delete;
+    uring_fd_writer(const uring_fd_writer&) = delete;
+    uring_fd_writer(uring_fd_writer&&) = delete;
+
+    ~uring_fd_writer() = default;
+
+    using result = typename impl_::result;
+    using impl_::recycle;
+    using impl_::finish;
+    using impl_::uses_io_uring;
+};
+
+#if ! defined(__cpp_inline_variables)
+
+template <typename CharT>
+constexpr std::size_t uring_fd_writer<CharT>::default_buffer_size;
+
+template <typename CharT>
+constexpr std::size_t uring_fd_writer<CharT>::default_buffers_count;
+
+#endif
+
+namespace detail {
+
+template <typename CharT>
+class uring_fd_writer_creator
+{
+public:
+
+    using char_type = CharT;
+    using destination_type = strf::uring_fd_writer<CharT>;
+    using finish_type = typename destination_type::result;
+
+    constexpr uring_fd_writer_creator(int fd) noexcept
+        : fd_(fd)
+    {}
+
+    constexpr uring_fd_writer_creator(const uring_fd_writer_creator&) = default;
+
+    typename destination_type::params create() const noexcept
+    {
+        return { fd_
+               , destination_type::default_buffer_size
+               , destination_type::default_buffers_count };
+    }
+
+private:
+    int fd_;
+};
+
+} // namespace detail
+
+template <typename CharT = char>
+inline auto to_uring_fd(int fd)
+    -> strf::destination_no_reserve<strf::detail::uring_fd_writer_creator<CharT>>
+{
+    return strf::destination_no_reserve
+        < strf::detail::uring_fd_writer_creator<CharT> >
+        (fd);
+}
+
+} // namespace strf
+
+#endif  // STRF_DETAIL_OUTPUT_TYPES_URING_FD_HPP
@@ -0,0 +1,234 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_utils.hpp"
+#include <strf/to_async_cfile.hpp>
+#include <chrono>
+#include <string>
+
+#if ! defined(_WIN32)
+#  include <unistd.h>
+#endif
+
+namespace {
+
+template <typename CharT>
+void test_successfull_writing()
+{
+    auto half_str = test_utils::make_half_string<CharT>();
+    auto long_str = test_utils::make_random_std_string<CharT>(10000);
+
+    std::FILE* file = std::tmpfile();
+    // small buffers, so that they are recycled many times
+    strf::async_cfile_writer<CharT> writer(file, strf::min_space_after_recycle<CharT>(), 2);
+
+    std::basic_string<CharT> expected;
+    for (int i = 0; i < 20; ++i) {
+        writer.write(half_str.begin(), half_str.size());
+        writer.write(long_str.data(), long_str.size());
+        expected.append(half_str.begin(), half_str.end());
+        expected.append(long_str);
+    }
+    auto status = writer.finish();
+    std::rewind(file);
+    auto obtained = test_utils::read_file<CharT>(file);
+    std::fclose(file);
+
+    TEST_TRUE(status.success);
+    TEST_EQ(status.error, 0);
+    TEST_EQ(status.count, expected.size());
+    TEST_TRUE(obtained == expected);
+
+    // calling finish() again returns the same result
+    auto status2 = writer.finish();
+    TEST_TRUE(status2.success);
+    TEST_EQ(status2.count, status.count);
+}
+
+template <typename CharT>
+void test_to_async()
+{
+    auto half_str = test_utils::make_half_string<CharT>();
+    auto long_str = test_utils::make_random_std_string<CharT>(200000);
+
+    std::FILE* file = std::tmpfile();
+    auto status = strf::to_async<CharT>(file) (half_str, long_str, half_str);
+    std::rewind(file);
+    auto obtained = test_utils::read_file<CharT>(file);
+    std::fclose(file);
+
+    std::basic_string<CharT> expected{half_str.begin(), half_str.end()};
+    expected.append(long_str);
+    expected.append(half_str.begin(), half_str.end());
+
+    TEST_TRUE(status.success);
+    TEST_EQ(status.count, expected.size());
+    TEST_TRUE(obtained == expected);
+}
+
+#if ! defined(_WIN32)
+
+// fsync fails with EINVAL on pipes and on /dev/null,
+// but finish() shall still succeed
+void test_finishing_on_unsyncable_files()
+{
+    {
+        std::FILE* file = std::fopen("/dev/null", "w");
+        TEST_TRUE(file != nullptr);
+        auto status = strf::to_async(file) ("hello");
+        std::fclose(file);
+        TEST_TRUE(status.success);
+        TEST_EQ(status.error, 0);
+        TEST_EQ(status.count, 5);
+    }
+    {
+        int fds[2];
+        TEST_EQ(::pipe(fds), 0);
+        std::FILE* file = ::fdopen(fds[1], "w");
+        auto status = strf::to_async(file) ("hello");
+        std::fclose(file);
+
+        char buff[16];
+        const auto n = ::read(fds[0], buff, sizeof(buff));
+        ::close(fds[0]);
+        TEST_TRUE(status.success);
+        TEST_EQ(status.error, 0);
+        TEST_EQ(status.count, 5);
+        TEST_EQ(n, 5);
+    }
+}
+
+#endif // ! defined(_WIN32)
+
+// Writes into a string, optionally sleeping on each write, and fails
+// with ENOSPC after limit characters.
+struct test_traits {
+    test_traits(std::string& dest, std::size_t limit, bool slow = false, bool sync_fails = false)
+        : dest_(dest)
+        , limit_(limit)
+        , slow_(slow)
+        , sync_fails_(sync_fails)
+    {
+    }
+
+    std::size_t write(const char* ptr, std::size_t count) noexcept
+    {
+        ++ writes_count;
+        if (slow_) {
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+        const std::size_t space = limit_ - dest_.size();
+        if (count > space) {
+            dest_.append(ptr, space);
+            errno = ENOSPC;
+            return space;
+        }
+        dest_.append(ptr, count);
+        return count;
+    }
+
+    bool sync() noexcept
+    {
+        ++ sync_count;
+        if (sync_fails_) {
+            errno = EIO;
+            return false;
+        }
+        return true;
+    }
+
+    std::string& dest_;
+    std::size_t limit_;
+    bool slow_;
+    bool sync_fails_;
+    static int writes_count;
+    static int sync_count;
+};
+
+int test_traits::writes_count = 0;
+int test_traits::sync_count = 0;
+
+using tester_t = strf::detail::async_cfile_writer_base<char, test_traits>;
+constexpr std::size_t buff_size = strf::min_space_after_recycle<char>();
+
+void test_back_pressure()
+{
+    // The writings are slower than the formatting,
+    // so recycle() needs to wait for a free buffer
+    std::string result;
+    test_traits::writes_count = 0;
+    test_traits::sync_count = 0;
+    tester_t tester{buff_size, 2, result, std::size_t(-1), true};
+    strf::to(tester) (strf::multi('a', buff_size * 10), strf::multi('b', 100));
+    auto r = tester.finish();
+
+    TEST_TRUE(r.success);
+    TEST_EQ(r.count, buff_size * 10 + 100);
+    TEST_EQ(result.size(), buff_size * 10 + 100);
+    TEST_TRUE(result == std::string(buff_size * 10, 'a') + std::string(100, 'b'));
+    TEST_TRUE(test_traits::writes_count >= 11);
+    TEST_EQ(test_traits::sync_count, 1);
+}
+
+void test_failing_to_write()
+{
+    std::string result;
+    tester_t tester{buff_size, 3, result, 100};
+    strf::to(tester) (strf::multi('x', buff_size * 20));
+    auto r = tester.finish();
+
+    TEST_FALSE(r.success);
+    TEST_EQ(r.count, 100);
+    TEST_EQ(r.error, ENOSPC);
+    TEST_EQ(result.size(), 100);
+}
+
+void test_failing_to_sync()
+{
+    std::string result;
+    tester_t tester{buff_size, 2, result, std::size_t(-1), false, true};
+    strf::to(tester) ("abc");
+    auto r = tester.finish();
+
+    TEST_FALSE(r.success);
+    TEST_EQ(r.count, 3);
+    TEST_EQ(r.error, EIO);
+    TEST_TRUE(result == "abc");
+}
+
+void test_when_finish_is_not_called()
+{
+    std::string result;
+    test_traits::sync_count = 0;
+    {
+        tester_t tester{buff_size, 2, result, std::size_t(-1)};
+        strf::to(tester) ("abc", strf::multi('x', buff_size * 3), "def");
+    }
+    // the destructor writes the remaining content, but does not sync
+    TEST_EQ(result.size(), buff_size * 3 + 6);
+    TEST_EQ(result.substr(0, 3), "abc");
+    TEST_EQ(result.substr(result.size() - 3), "def");
+    TEST_EQ(test_traits::sync_count, 0);
+}
+
+} // unnamed namespace
+
+void test_async_cfile_writer()
+{
+    test_successfull_writing<char>();
+    test_successfull_writing<char16_t>();
+    test_successfull_writing<char32_t>();
+
+    test_to_async<char>();
+    test_to_async<char16_t>();
+#if ! defined(_WIN32)
+    test_finishing_on_unsyncable_files();
+#endif
+
+    test_back_pressure();
+    test_failing_to_write();
+    test_failing_to_sync();
+    test_when_finish_is_not_called();
+}
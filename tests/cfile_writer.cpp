@@ -7,6 +7,9 @@
 
 #include <ctime>
 #include <cstdlib>
+#if !defined(_WIN32)
+#  include <thread>
+#endif
 #if defined(__GNUC__)
 #  pragma GCC diagnostic ignored "-Warray-bounds"
 #endif
@@ -330,6 +333,88 @@ void test_narrow_cfile_writer_creator()
 
 }
 
+template <typename CharT>
+void test_narrow_cfile_writer_creator_with_buffer_size()
+{
+    auto half_str = test_utils::make_half_string<CharT>();
+    auto long_str = test_utils::make_random_std_string<CharT>(3000);
+
+    auto path = test_utils::unique_tmp_file_name();
+    std::FILE* file = std::fopen(path.c_str(), "w");
+
+    auto status = strf::to<1024, CharT>(file)(half_str, long_str, half_str);
+    std::fclose(file);
+    auto obtained_content = test_utils::read_file<CharT>(path.c_str());
+    std::remove(path.c_str());
+
+    std::basic_string<CharT> expected_content;
+    expected_content.append(half_str.begin(), half_str.size());
+    expected_content.append(long_str);
+    expected_content.append(half_str.begin(), half_str.size());
+
+    TEST_TRUE(status.success);
+    TEST_EQ(status.count, expected_content.size());
+    TEST_TRUE(obtained_content == expected_content);
+}
+
+template <typename CharT>
+void test_locked_cfile_writer()
+{
+    auto half_str = test_utils::make_half_string<CharT>();
+    auto long_str = test_utils::make_random_std_string<CharT>(3000);
+
+    std::basic_string<CharT> expected_content;
+    expected_content.append(half_str.begin(), half_str.size());
+    expected_content.append(long_str);
+    expected_content.append(half_str.begin(), half_str.size());
+
+    {
+        auto path = test_utils::unique_tmp_file_name();
+        std::FILE* file = std::fopen(path.c_str(), "w");
+
+        auto status1 = strf::to_locked<CharT>(file)(half_str, long_str);
+        auto status2 = strf::to_locked<512, CharT>(file)(half_str);
+        std::fclose(file);
+        auto obtained_content = test_utils::read_file<CharT>(path.c_str());
+        std::remove(path.c_str());
+
+        TEST_TRUE(status1.success);
+        TEST_TRUE(status2.success);
+        TEST_EQ(status1.count + status2.count, expected_content.size());
+        TEST_TRUE(obtained_content == expected_content);
+    }
+    {   // when finish() is not called
+        auto path = test_utils::unique_tmp_file_name();
+        std::FILE* file = std::fopen(path.c_str(), "w");
+        {
+            strf::locked_cfile_writer<CharT, 100> writer(file);
+            writer.write(half_str.begin(), half_str.size());
+            writer.write(long_str.data(), long_str.size());
+            writer.write(half_str.begin(), half_str.size());
+        }
+        // the destructor shall flush the content and unlock the file
+#if !defined(_WIN32)
+        // flockfile is recursive, so this must be checked from another thread
+        bool locked_by_other_thread = false;
+        std::thread t{[file, &locked_by_other_thread](){
+            if (ftrylockfile(file) == 0) {
+                locked_by_other_thread = true;
+                funlockfile(file);
+            }
+        }};
+        t.join();
+        TEST_TRUE(locked_by_other_thread);
+#endif
+        strf::to<CharT>(file) (half_str);
+        std::fclose(file);
+        auto obtained_content = test_utils::read_file<CharT>(path.c_str());
+        std::remove(path.c_str());
+
+        expected_content.append(half_str.begin(), half_str.size());
+        TEST_TRUE(obtained_content == expected_content);
+    }
+}
+
 void test_wide_cfile_writer_creator()
 {
     auto half_str = test_utils::make_half_string<wchar_t>();
@@ -366,6 +451,10 @@ void test_cfile_writer()
     test_narrow_cfile_writer_creator<char16_t>();
     test_narrow_cfile_writer_creator<char32_t>();
     test_narrow_cfile_writer_creator<wchar_t>();
+    test_narrow_cfile_writer_creator_with_buffer_size<char>();
+    test_narrow_cfile_writer_creator_with_buffer_size<char32_t>();
+    test_locked_cfile_writer<char>();
+    test_locked_cfile_writer<char16_t>();
     test_wide_cfile_writer_creator();
 
     test_narrow_successfull_writing<char>();
@@ -105,64 +105,27 @@ struct codepoint_properties {
 
 codepoint_properties props_according_to_strf(UChar32 ch) {
     using namespace strf::width_literal;
-    strf::width_t ch_width = 1_w;
-    if (ch <= 0x007E) {
-        if (0x20 <= ch) {
-            handle_other:
-            return {category::other, ch_width};
-        }
-        if (0x000D == ch) { // CR
-            return {category::cr, 1};
-        }
-        if (0x000A == ch) { // LF
-            return {category::lf, 1};
-        }
-        handle_control:
-        return {category::control, ch_width};
-    }
-
-#include <strf/detail/ch32_width_and_gcb_prop>
-    goto force_failure;
-
-    handle_zwj:
-    return {category::zwj, ch_width};
-
-    handle_extend:
-    handle_extend_and_control:
-    return {category::extend, ch_width};
-
-    handle_spacing_mark:
-    return {category::spacing_mark, ch_width};
-
-    handle_prepend:
-    return {category::prepend, ch_width};
-
-    handle_regional_indicator:
-    return {category::regional_indicator, ch_width};
-
-    handle_extended_picto:
-    return {category::extended_picto, ch_width};
-
-    handle_hangul_l:
-    return {category::hangul_l, ch_width};
-
-    handle_hangul_v:
-    return {category::hangul_v, ch_width};
-
-    handle_hangul_t:
-    return {category::hangul_t, ch_width};
-
-    handle_hangul_lv_or_lvt:
-    if ( ch <= 0xD788 // && 0xAC00 <= ch
-         && 0 == (ch & 3)
-         && 0 == ((ch - 0xAC00) >> 2) % 7)
-    {   // LV
-        return {category::hangul_lv, ch_width};
-    } else {
-        return {category::hangul_lvt, ch_width};
+    namespace gcb_prop = strf::detail::gcb_prop;
+
+    const unsigned prop = strf::detail::ch32_width_and_gcb_prop(static_cast<char32_t>(ch));
+    const strf::width_t ch_width = (prop & gcb_prop::wide) ? 2_w : 1_w;
+    switch (prop & gcb_prop::category_mask) {
+        case gcb_prop::other:              return {category::other, ch_width};
+        case gcb_prop::extend:             return {category::extend, ch_width};
+        case gcb_prop::control:            return {category::control, ch_width};
+        case gcb_prop::cr:                 return {category::cr, ch_width};
+        case gcb_prop::lf:                 return {category::lf, ch_width};
+        case gcb_prop::spacing_mark:       return {category::spacing_mark, ch_width};
+        case gcb_prop::prepend:            return {category::prepend, ch_width};
+        case gcb_prop::hangul_l:           return {category::hangul_l, ch_width};
+        case gcb_prop::hangul_v:           return {category::hangul_v, ch_width};
+        case gcb_prop::hangul_t:           return {category::hangul_t, ch_width};
+        case gcb_prop::hangul_lv:          return {category::hangul_lv, ch_width};
+        case gcb_prop::hangul_lvt:         return {category::hangul_lvt, ch_width};
+        case gcb_prop::regional_indicator: return {category::regional_indicator, ch_width};
+        case gcb_prop::zwj:                return {category::zwj, ch_width};
+        case gcb_prop::extended_picto:     return {category::extended_picto, ch_width};
     }
-
-    force_failure:
     return {static_cast<category>(100), 100};
 }
 
@@ -0,0 +1,395 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_utils.hpp"
+#include <strf/to_chunks.hpp>
+
+#if defined(__has_include)
+#  if __has_include(<memory_resource>) && __cplusplus >= 201703L
+#    include <memory_resource>
+#  endif
+#endif
+
+namespace {
+
+// A monotonic arena: deallocate does not release memory,
+// it only counts how many characters were given back.
+template <typename CharT>
+struct arena {
+    alignas(std::max_align_t) unsigned char mem[1 << 18];
+    std::size_t used = 0;
+    std::size_t allocations_count = 0;
+    std::size_t allocated = 0;
+    std::size_t deallocated = 0;
+};
+
+template <typename T, typename CharT>
+class arena_allocator
+{
+public:
+    using value_type = T;
+
+    explicit arena_allocator(arena<CharT>& a) noexcept
+        : arena_(&a)
+    {
+    }
+
+    template <typename U>
+    arena_allocator(const arena_allocator<U, CharT>& other) noexcept
+        : arena_(other.arena_)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        const std::size_t bytes = n * sizeof(T);
+        const std::size_t align = alignof(std::max_align_t);
+        const std::size_t begin = (arena_->used + align - 1) & ~(align - 1);
+        if (begin + bytes > sizeof(arena_->mem)) {
+            throw std::bad_alloc();
+        }
+        arena_->used = begin + bytes;
+        if (std::is_same<T, CharT>::value) {
+            ++ arena_->allocations_count;
+            arena_->allocated += n;
+        }
+        return reinterpret_cast<T*>(arena_->mem + begin);
+    }
+
+    void deallocate(T*, std::size_t n) noexcept
+    {
+        if (std::is_same<T, CharT>::value) {
+            arena_->deallocated += n;
+        }
+    }
+
+    template <typename U>
+    bool operator==(const arena_allocator<U, CharT>& other) const noexcept
+    {
+        return arena_ == other.arena_;
+    }
+    template <typename U>
+    bool operator!=(const arena_allocator<U, CharT>& other) const noexcept
+    {
+        return arena_ != other.arena_;
+    }
+
+    arena<CharT>* arena_;
+};
+
+// Forwards to std::allocator, counting how many times memory is
+// allocated for anything other than characters, i.e. chunk descriptors
+template <typename T, typename CharT>
+class counting_allocator
+{
+public:
+    using value_type = T;
+
+    explicit counting_allocator(std::size_t& count) noexcept
+        : count_(&count)
+    {
+    }
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U, CharT>& other) noexcept
+        : count_(other.count_)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if ( ! std::is_same<T, CharT>::value) {
+            ++ *count_;
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const counting_allocator<U, CharT>& other) const noexcept
+    {
+        return count_ == other.count_;
+    }
+    template <typename U>
+    bool operator!=(const counting_allocator<U, CharT>& other) const noexcept
+    {
+        return count_ != other.count_;
+    }
+
+    std::size_t* count_;
+};
+
+template <typename CharT>
+void test_several_chunks()
+{
+    constexpr std::size_t min_size = strf::min_space_after_recycle<CharT>();
+    auto half_str = test_utils::make_half_string<CharT>();
+    auto long_str = test_utils::make_random_std_string<CharT>(min_size * 10);
+
+    strf::basic_chunked_writer<CharT> writer(min_size, min_size * 4);
+    const CharT* const first_chunk_data = writer.buffer_ptr();
+
+    std::basic_string<CharT> expected;
+    for (int i = 0; i < 5; ++i) {
+        strf::to(writer) (half_str, strf::multi(static_cast<CharT>('x'), min_size * 3));
+        expected.append(half_str.begin(), half_str.size());
+        expected.append(min_size * 3, static_cast<CharT>('x'));
+    }
+    writer.write(long_str.data(), long_str.size());
+    expected.append(long_str);
+    writer.write(half_str.begin(), half_str.size());
+    expected.append(half_str.begin(), half_str.size());
+
+    auto chunks = writer.finish();
+    TEST_FALSE(writer.good());
+
+    // already written content is never moved
+    TEST_TRUE(chunks[0].data == first_chunk_data);
+
+    // the chunks grow geometrically up to max_chunk_size, except the
+    // one allocated by do_write to fit the rest of a large string
+    TEST_EQ(chunks[0].capacity, min_size);
+    TEST_EQ(chunks[1].capacity, min_size * 2);
+    TEST_EQ(chunks[2].capacity, min_size * 4);
+    TEST_EQ(chunks[3].capacity, min_size * 4);
+    std::size_t total = 0;
+    for (const auto& c : chunks) {
+        TEST_TRUE(c.size <= c.capacity);
+        TEST_TRUE(0 == expected.compare(total, c.size, c.data, c.size));
+        total += c.size;
+    }
+    TEST_EQ(total, expected.size());
+    TEST_EQ(chunks.total_size(), expected.size());
+    TEST_TRUE(chunks.to_string() == expected);
+
+    std::basic_string<CharT> copy(expected.size(), static_cast<CharT>('_'));
+    CharT* end = chunks.copy_to(&copy[0]);
+    TEST_TRUE(end == &copy[0] + copy.size());
+    TEST_TRUE(copy == expected);
+}
+
+template <typename CharT>
+void test_fixed_size_chunks()
+{
+    constexpr std::size_t size = strf::min_space_after_recycle<CharT>();
+    strf::basic_chunked_writer<CharT> writer(size, size);
+    strf::to(writer) (strf::multi(static_cast<CharT>('a'), size * 5 + 1));
+    auto chunks = writer.finish();
+
+    TEST_EQ(chunks.size(), 6);
+    for (const auto& c : chunks) {
+        TEST_EQ(c.capacity, size);
+    }
+    TEST_EQ(chunks[5].size, 1);
+    TEST_EQ(chunks.total_size(), size * 5 + 1);
+}
+
+template <typename CharT>
+void test_many_chunks()
+{
+    // the vector of chunk descriptors grows geometrically
+    using alloc_t = counting_allocator<CharT, CharT>;
+    constexpr std::size_t size = strf::min_space_after_recycle<CharT>();
+    constexpr std::size_t chunks_count = 20000;
+    std::size_t descriptor_allocations = 0;
+    strf::basic_chunked_writer<CharT, alloc_t> writer
+        (size, size, alloc_t{descriptor_allocations});
+    for (std::size_t i = 0; i < chunks_count; ++i) {
+        strf::to(writer) (strf::multi(static_cast<CharT>('a'), size));
+    }
+    auto chunks = writer.finish();
+
+    TEST_EQ(chunks.size(), chunks_count);
+    TEST_EQ(chunks.total_size(), size * chunks_count);
+    TEST_TRUE(descriptor_allocations <= 16);
+}
+
+template <typename CharT>
+void test_to_chunks()
+{
+    auto half_str = test_utils::make_half_string<CharT>();
+    auto long_str = test_utils::make_random_std_string<CharT>(5000);
+
+    std::basic_string<CharT> expected;
+    expected.append(half_str.begin(), half_str.size());
+    expected.append(long_str);
+    expected.append(half_str.begin(), half_str.size());
+
+    {   // without size pre-calculation
+        auto chunks = strf::to_chunks<CharT>() (half_str, long_str, half_str);
+        TEST_TRUE(chunks.size() > 1);
+        TEST_TRUE(chunks.to_string() == expected);
+    }
+    {   // with size pre-calculation, everything goes into a single chunk
+        auto chunks = strf::to_chunks<CharT>() .reserve_calc() (half_str, long_str, half_str);
+        TEST_EQ(chunks.size(), 1);
+        TEST_EQ(chunks[0].size, expected.size());
+        TEST_EQ(chunks[0].capacity, expected.size());
+        TEST_TRUE(chunks.to_string() == expected);
+    }
+    {   // with a given size that is too small
+        auto chunks = strf::to_chunks<CharT>() .reserve(10) (half_str, long_str, half_str);
+        TEST_TRUE(chunks.to_string() == expected);
+    }
+    {   // when nothing is written
+        auto chunks = strf::to_chunks<CharT>() ();
+        TEST_EQ(chunks.total_size(), 0);
+        TEST_TRUE(chunks.to_string().empty());
+    }
+}
+
+template <typename CharT>
+void test_arena_allocator()
+{
+    using alloc_t = arena_allocator<CharT, CharT>;
+    auto long_str = test_utils::make_random_std_string<CharT>(3000);
+
+    arena<CharT> a;
+    {
+        auto chunks = strf::to_chunks<CharT>(alloc_t{a})
+            (long_str, strf::multi(static_cast<CharT>('z'), 20000));
+
+        TEST_TRUE(a.allocations_count > 1);
+        TEST_EQ(a.allocations_count, chunks.size());
+        for (const auto& c : chunks) {
+            const auto* p = reinterpret_cast<const unsigned char*>(c.data);
+            TEST_TRUE(a.mem <= p && p < a.mem + sizeof(a.mem));
+        }
+        auto str = chunks.to_string();
+        TEST_EQ(str.size(), long_str.size() + 20000);
+        TEST_TRUE(0 == str.compare(0, long_str.size(), long_str));
+        TEST_EQ(a.deallocated, 0);
+
+        // moving the list does not copy nor free the chunks
+        auto chunks2 = std::move(chunks);
+        TEST_EQ(chunks.size(), 0);
+        TEST_EQ(chunks2.total_size(), str.size());
+        TEST_EQ(a.deallocated, 0);
+    }
+    TEST_EQ(a.deallocated, a.allocated);
+
+    {   // when finish() is not called, the chunks are given back
+        arena<CharT> a2;
+        {
+            strf::basic_chunked_writer<CharT, alloc_t> writer{alloc_t{a2}};
+            strf::to(writer) (strf::multi(static_cast<CharT>('z'), 5000));
+        }
+        TEST_TRUE(a2.allocated > 0);
+        TEST_EQ(a2.deallocated, a2.allocated);
+    }
+}
+
+template <typename CharT>
+void test_move_assignment()
+{
+    using alloc_t = arena_allocator<CharT, CharT>;
+    auto long_str = test_utils::make_random_std_string<CharT>(3000);
+
+    arena<CharT> a1;
+    arena<CharT> a2;
+    {   // same arena: the chunks are just transferred
+        auto chunks = strf::to_chunks<CharT>(alloc_t{a1}) (long_str);
+        auto chunks2 = strf::to_chunks<CharT>(alloc_t{a1}) (strf::multi(static_cast<CharT>('x'), 10));
+        const auto allocations_count = a1.allocations_count;
+        chunks2 = std::move(chunks);
+        TEST_EQ(chunks.size(), 0);
+        TEST_EQ(a1.allocations_count, allocations_count);
+        TEST_TRUE(chunks2.to_string() == long_str);
+    }
+    TEST_EQ(a1.deallocated, a1.allocated);
+    {   // arena_allocator does not propagate on move assignment, so the
+        // content is copied into a chunk from the destination's arena
+        auto chunks = strf::to_chunks<CharT>(alloc_t{a1}) (long_str);
+        strf::basic_chunk_list<CharT, alloc_t> chunks2{alloc_t{a2}};
+        chunks2 = std::move(chunks);
+        TEST_EQ(chunks.size(), 0);
+        TEST_EQ(a1.deallocated, a1.allocated);
+        TEST_TRUE(a2.allocated >= long_str.size());
+        TEST_TRUE(chunks2.to_string() == long_str);
+        for (const auto& c : chunks2) {
+            const auto* p = reinterpret_cast<const unsigned char*>(c.data);
+            TEST_TRUE(a2.mem <= p && p < a2.mem + sizeof(a2.mem));
+        }
+    }
+    TEST_EQ(a2.deallocated, a2.allocated);
+}
+
+#if defined(__cpp_lib_memory_resource)
+
+void test_pmr_allocator()
+{
+    using alloc_t = std::pmr::polymorphic_allocator<char>;
+    alignas(std::max_align_t) unsigned char mem1[1 << 16];
+    alignas(std::max_align_t) unsigned char mem2[1 << 16];
+    std::pmr::monotonic_buffer_resource res1{mem1, sizeof(mem1), std::pmr::null_memory_resource()};
+    std::pmr::monotonic_buffer_resource res2{mem2, sizeof(mem2), std::pmr::null_memory_resource()};
+
+    auto chunks = strf::to_chunks<char>(alloc_t{&res1}) ("abc", strf::multi('x', 2000));
+    TEST_TRUE(chunks.size() > 1);
+    TEST_EQ(chunks.total_size(), 2003);
+
+    auto chunks2 = strf::to_chunks<char>(alloc_t{&res1}) ("def");
+    chunks2 = std::move(chunks);
+    TEST_EQ(chunks.size(), 0);
+    TEST_EQ(chunks2.total_size(), 2003);
+
+    strf::basic_chunk_list<char, alloc_t> chunks3{alloc_t{&res2}};
+    chunks3 = std::move(chunks2);
+    TEST_EQ(chunks2.size(), 0);
+    const auto str = chunks3.to_string();
+    TEST_EQ(str.size(), 2003);
+    TEST_TRUE(str.compare(0, 4, "abcx") == 0);
+    for (const auto& c : chunks3) {
+        const auto* p = reinterpret_cast<const unsigned char*>(c.data);
+        TEST_TRUE(mem2 <= p && p < mem2 + sizeof(mem2));
+    }
+}
+
+#endif // defined(__cpp_lib_memory_resource)
+
+void test_finish_to_string()
+{
+    strf::chunked_writer writer;
+    strf::to(writer) ("abc", 123, strf::multi('x', 1000), "def");
+    auto str = writer.finish_to_string();
+    TEST_EQ(str.size(), 1009);
+    TEST_TRUE(str.compare(0, 6, "abc123") == 0);
+    TEST_TRUE(str.compare(1006, 3, "def") == 0);
+}
+
+} // unnamed namespace
+
+void test_chunked_writer()
+{
+    test_several_chunks<char>();
+    test_several_chunks<char16_t>();
+    test_several_chunks<char32_t>();
+    test_several_chunks<wchar_t>();
+
+    test_fixed_size_chunks<char>();
+    test_fixed_size_chunks<char32_t>();
+
+    test_many_chunks<char>();
+
+    test_to_chunks<char>();
+    test_to_chunks<char16_t>();
+    test_to_chunks<wchar_t>();
+
+    test_arena_allocator<char>();
+    test_arena_allocator<char32_t>();
+
+    test_move_assignment<char>();
+    test_move_assignment<char16_t>();
+
+#if defined(__cpp_lib_memory_resource)
+    test_pmr_allocator();
+#endif
+
+    test_finish_to_string();
+}
@@ -0,0 +1,291 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_utils.hpp"
+
+#if ! defined(_WIN32)
+
+#include <strf/to_fd.hpp>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+template <typename CharT>
+void test_successfull_writing()
+{
+    auto tiny_str = test_utils::make_tiny_string<CharT>();
+    auto double_str = test_utils::make_double_string<CharT>();
+
+    auto path = test_utils::unique_tmp_file_name();
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    strf::fd_writer<CharT, strf::min_space_after_recycle<CharT>()> writer(fd);
+
+    writer.write(tiny_str.begin(), tiny_str.size());
+    writer.write(double_str.begin(), double_str.size());
+    writer.write(tiny_str.begin(), tiny_str.size());
+    auto status = writer.finish();
+    ::close(fd);
+    auto obtained_content = test_utils::read_file<CharT>(path.c_str());
+    std::remove(path.c_str());
+
+    TEST_TRUE(status.success);
+    TEST_EQ(status.count, obtained_content.size());
+    TEST_EQ(status.count, 2 * tiny_str.size() + double_str.size());
+    TEST_TRUE(0 == obtained_content.compare( 0, tiny_str.size()
+                                           , tiny_str.begin()
+                                           , tiny_str.size() ));
+    TEST_TRUE(0 == obtained_content.compare( tiny_str.size()
+                                           , double_str.size()
+                                           , double_str.begin()
+                                           , double_str.size() ));
+    TEST_TRUE(0 == obtained_content.compare( tiny_str.size() + double_str.size()
+                                           , tiny_str.size()
+                                           , tiny_str.begin()
+                                           , tiny_str.size() ));
+}
+
+template <typename CharT>
+void test_fd_writer_creator()
+{
+    auto half_str = test_utils::make_half_string<CharT>();
+    auto full_str = test_utils::make_full_string<CharT>();
+    auto long_str = test_utils::make_random_std_string<CharT>(10000);
+
+    auto path = test_utils::unique_tmp_file_name();
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+
+    auto status = strf::to_fd<CharT>(fd)(half_str, long_str, full_str);
+    ::close(fd);
+    auto obtained_content = test_utils::read_file<CharT>(path.c_str());
+    std::remove(path.c_str());
+
+    std::basic_string<CharT> expected_content;
+    expected_content.append(half_str.begin(), half_str.size());
+    expected_content.append(long_str);
+    expected_content.append(full_str.begin(), full_str.size());
+
+    TEST_TRUE(status.success);
+    TEST_EQ(status.count, expected_content.size());
+    TEST_TRUE(obtained_content == expected_content);
+}
+
+void test_fd_writer_creator_with_buffer_size()
+{
+    auto long_str = test_utils::make_random_std_string<char>(100000);
+
+    auto path = test_utils::unique_tmp_file_name();
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+
+    auto status = strf::to_fd<65536>(fd)
+        (strf::multi('a', 50000), long_str, strf::multi('b', 50000));
+    ::close(fd);
+    auto obtained_content = test_utils::read_file<char>(path.c_str());
+    std::remove(path.c_str());
+
+    std::string expected_content(50000, 'a');
+    expected_content.append(long_str);
+    expected_content.append(50000, 'b');
+
+    TEST_TRUE(status.success);
+    TEST_EQ(status.error, 0);
+    TEST_EQ(status.count, expected_content.size());
+    TEST_TRUE(obtained_content == expected_content);
+}
+
+void test_writing_to_read_only_fd()
+{
+    int fd = ::open("/dev/null", O_RDONLY);
+    auto status = strf::to_fd(fd) ("abc");
+    ::close(fd);
+    TEST_FALSE(status.success);
+    TEST_EQ(status.count, 0);
+    TEST_EQ(status.error, EBADF);
+}
+
+static int writev_calls_count = 0;
+
+// Writes at most max_bytes_per_call bytes per call to writev,
+// and fails with ENOSPC after limit bytes. If interrupt is true,
+// every other call fails with EINTR.
+struct traits_that_writes_partially {
+    traits_that_writes_partially
+        ( char* dest
+        , std::size_t limit
+        , std::size_t max_bytes_per_call
+        , bool interrupt = false )
+        : dest_(dest)
+        , dest_end_(dest + limit)
+        , max_bytes_per_call_(max_bytes_per_call)
+        , interrupt_(interrupt)
+    {
+    }
+
+    ssize_t writev(const struct iovec* iov, int iovcnt) noexcept {
+        if (interrupt_) {
+            interrupted_ = ! interrupted_;
+            if (interrupted_) {
+                errno = EINTR;
+                return -1;
+            }
+        }
+        std::size_t space = dest_end_ - dest_;
+        if (space == 0) {
+            errno = ENOSPC;
+            return -1;
+        }
+        std::size_t max = max_bytes_per_call_ < space ? max_bytes_per_call_ : space;
+        std::size_t count = 0;
+        for (int i = 0; i < iovcnt && count < max; ++i) {
+            std::size_t n = iov[i].iov_len < max - count ? iov[i].iov_len : max - count;
+            memcpy(dest_, iov[i].iov_base, n);
+            dest_ += n;
+            count += n;
+        }
+        ++writev_calls_count;
+        return static_cast<ssize_t>(count);
+    }
+
+    char* dest_;
+    char* dest_end_;
+    std::size_t max_bytes_per_call_;
+    bool interrupt_;
+    bool interrupted_ = false;
+};
+
+void test_fd_writer_base()
+{
+    char buff[strf::min_space_after_recycle<char>()];
+    char result_buff[strf::min_space_after_recycle<char>() * 4];
+
+    using tester_t = strf::detail::fd_writer_base<char, traits_that_writes_partially>;
+
+    {   // partial writes
+        memset(result_buff, 0, sizeof(result_buff));
+        tester_t tester{buff, sizeof(buff), result_buff, sizeof(result_buff), 7};
+
+        strf::to(tester) ("ABCD", strf::multi('x', sizeof(buff)), "0123456789abcdef");
+        tester.write("0123456789abcdef", 16);
+        auto r = tester.finish();
+
+        TEST_TRUE(r.success);
+        TEST_EQ(r.error, 0);
+        char expected[sizeof(result_buff)];
+        auto r2 = strf::to(expected)
+            ( "ABCD", strf::multi('x', sizeof(buff)), "0123456789abcdef"
+            , "0123456789abcdef" );
+        TEST_EQ(r.count, size_t(r2.ptr - expected));
+        TEST_STRVIEW_EQ(result_buff, expected, r.count);
+    }
+    {   // partial and interrupted writes
+        memset(result_buff, 0, sizeof(result_buff));
+        tester_t tester{buff, sizeof(buff), result_buff, sizeof(result_buff), 5, true};
+
+        strf::to(tester) ("ABCD", strf::multi('x', sizeof(buff)), "0123456789abcdef");
+        tester.write("0123456789abcdef", 16);
+        auto r = tester.finish();
+
+        TEST_TRUE(r.success);
+        TEST_EQ(r.error, 0);
+        char expected[sizeof(result_buff)];
+        auto r2 = strf::to(expected)
+            ( "ABCD", strf::multi('x', sizeof(buff)), "0123456789abcdef"
+            , "0123456789abcdef" );
+        TEST_EQ(r.count, size_t(r2.ptr - expected));
+        TEST_STRVIEW_EQ(result_buff, expected, r.count);
+    }
+    {   // a large string is written together with the buffer content
+        memset(result_buff, 0, sizeof(result_buff));
+        tester_t tester{buff, sizeof(buff), result_buff, sizeof(result_buff), 1000};
+
+        strf::to(tester) ("ABCD");
+        char large_str[sizeof(buff) * 2];
+        memset(large_str, 'y', sizeof(large_str));
+        writev_calls_count = 0;
+        tester.write(large_str, sizeof(large_str));
+        TEST_EQ(writev_calls_count, 1);
+        TEST_EQ(tester.buffer_ptr(), buff);
+        auto r = tester.finish();
+
+        TEST_TRUE(r.success);
+        TEST_EQ(r.count, 4 + sizeof(large_str));
+        TEST_STRVIEW_EQ(result_buff, "ABCDyyyy", 8);
+    }
+    {   // fails on recycle()
+        memset(result_buff, 0, sizeof(result_buff));
+        tester_t tester{buff, sizeof(buff), result_buff, 10, 3};
+
+        memcpy(tester.buffer_ptr(), "0123456789abcdef", 16);
+        tester.advance(16);
+        tester.recycle();
+        TEST_FALSE(tester.good());
+        TEST_STRVIEW_EQ(result_buff, "0123456789", 10);
+
+        auto r = tester.finish();
+        TEST_FALSE(r.success);
+        TEST_EQ(r.count, 10);
+        TEST_EQ(r.error, ENOSPC);
+    }
+    {   // fails on do_write()
+        memset(result_buff, 0, sizeof(result_buff));
+        tester_t tester{buff, sizeof(buff), result_buff, 10, 100};
+
+        strf::to(tester) (strf::multi('x', tester.buffer_space()));
+        tester.write("0123456789abcdef", 16);
+        TEST_STRVIEW_EQ(result_buff, "xxxxxxxxxx", 10);
+        TEST_FALSE(tester.good());
+
+        auto r = tester.finish();
+        TEST_FALSE(r.success);
+        TEST_EQ(r.count, 10);
+        TEST_EQ(r.error, ENOSPC);
+    }
+    {   // fails on finish()
+        memset(result_buff, 0, sizeof(result_buff));
+        tester_t tester{buff, sizeof(buff), result_buff, 10, 100};
+
+        memcpy(tester.buffer_ptr(), "0123456789abcdef", 16);
+        tester.advance(16);
+        auto r = tester.finish();
+
+        TEST_FALSE(r.success);
+        TEST_EQ(r.count, 10);
+        TEST_EQ(r.error, ENOSPC);
+        TEST_STRVIEW_EQ(result_buff, "0123456789", 10);
+    }
+    {   // when finish() is not called
+        memset(result_buff, 0, sizeof(result_buff));
+        {
+            tester_t tester{buff, sizeof(buff), result_buff, sizeof(result_buff), 3};
+            memcpy(tester.buffer_ptr(), "ABCD", 4);
+            tester.advance(4);
+        }
+        // the destructor shall flush the content left in the buffer
+        TEST_CSTR_EQ(result_buff, "ABCD");
+    }
+}
+
+void test_fd_writer()
+{
+    test_fd_writer_base();
+
+    test_successfull_writing<char>();
+    test_successfull_writing<char16_t>();
+    test_successfull_writing<char32_t>();
+    test_successfull_writing<wchar_t>();
+
+    test_fd_writer_creator<char>();
+    test_fd_writer_creator<char16_t>();
+    test_fd_writer_creator<char32_t>();
+    test_fd_writer_creator_with_buffer_size();
+    test_writing_to_read_only_fd();
+}
+
+#else // ! defined(_WIN32)
+
+void test_fd_writer()
+{
+}
+
+#endif // ! defined(_WIN32)
@@ -703,6 +703,16 @@ STRF_TEST_FUNC void test_punctuation()
         TEST("_________+1:000:000,").with(p) (j(*+!strf::fixed(1000000.0)));
         TEST("_____+1:000:000,0000").with(p) (j(*+!strf::fixed(1000000.0).p(4)));
         TEST("__+00000001:000:000,").with(p) (j(*+!strf::fixed(1000000.0).pad0(18)));
+        TEST("_______1:234:567:890").with(p) (j(!strf::fixed(1234567890.0)));
+        TEST("_______1:000:000:000").with(p) (j(!strf::fixed(1e+9)));
+        TEST("1:000:000:000:000:000:000").with(p) (!strf::fixed(1e+18));
+        TEST("10:000:000:000:000:000:000").with(p) (!strf::fixed(1e+19));
+        TEST("12:345:678:900:000:000:000").with(p) (!strf::fixed(1.23456789e+19));
+        TEST("1:234:567:890:000:000:000").with(p) (!strf::fixed(1.23456789e+18));
+        TEST("12:34:56:78:90").with(strf::numpunct<10>{2}.thousands_sep(':'))
+            (!strf::fixed(1234567890.0));
+        TEST("1:2345:6789:0000").with(strf::numpunct<10>{4}.thousands_sep(':'))
+            (!strf::fixed(1234567890000.0));
 
         auto px = strf::numpunct<16>{3}.decimal_point(',');
         TEST("________0x1,12345p+0").with(px) (j(!strf::hex(0x1.12345p+0)));
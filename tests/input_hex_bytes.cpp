@@ -0,0 +1,123 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_utils.hpp"
+
+namespace {
+
+// enough to cover several iterations of the SIMD kernels
+constexpr std::size_t long_input_size = 100;
+
+// Writes the expected output byte by byte, using strf::hex
+template <typename CharT>
+STRF_TEST_FUNC std::size_t write_expected
+    ( CharT* buff
+    , std::size_t buff_size
+    , const unsigned char* bytes
+    , std::size_t count
+    , char sep
+    , strf::lettercase lc )
+{
+    strf::basic_cstr_writer<CharT> writer(buff, buff_size);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (sep != '\0' && i != 0) {
+            strf::to(writer) (static_cast<CharT>(sep));
+        }
+        strf::to(writer).with(lc) (strf::hex(bytes[i]).pad0(2));
+    }
+    return static_cast<std::size_t>(writer.finish().ptr - buff);
+}
+
+STRF_TEST_FUNC void fill_bytes(unsigned char* bytes, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        bytes[i] = static_cast<unsigned char>((i * 37) ^ (i >> 3));
+    }
+}
+
+template <typename CharT>
+STRF_TEST_FUNC void test_long_input(char sep, strf::lettercase lc)
+{
+    unsigned char bytes[long_input_size];
+    fill_bytes(bytes, long_input_size);
+
+    // the output may not fit in the buffer of the TEST macro
+    constexpr std::size_t buff_size = 3 * long_input_size;
+    CharT expected[buff_size];
+    CharT obtained[buff_size];
+
+    // some sizes are not multiples of the SIMD register sizes
+    const std::size_t long_sizes[] = {long_input_size, long_input_size - 1, 65};
+    for (auto size : long_sizes) {
+        const auto expected_len = write_expected(expected, buff_size, bytes, size, sep, lc);
+        const auto* end = strf::to(obtained, buff_size).with(lc)
+            (strf::hex_bytes(bytes, size, sep)).ptr;
+        TEST_EQ(static_cast<std::size_t>(end - obtained), expected_len);
+        TEST_TRUE(strf::detail::str_equal(obtained, expected, expected_len));
+    }
+    const std::size_t short_sizes[] = {47, 33, 17};
+    for (auto size : short_sizes) {
+        write_expected(expected, buff_size, bytes, size, sep, lc);
+        TEST(expected).with(lc) (strf::hex_bytes(bytes, size, sep));
+    }
+}
+
+// The SIMD path, when the destination has an odd number of free
+// positions, leaving one of them unused, at each recycle
+STRF_TEST_FUNC void test_odd_space_at_recycle()
+{
+    unsigned char bytes[64];
+    fill_bytes(bytes, 64);
+    char expected[129];
+    write_expected(expected, sizeof(expected), bytes, 64, '\0', strf::lowercase);
+
+    TEST_CALLING_RECYCLE_AT<33, 41, 60> (expected) (strf::hex_bytes(bytes, 64));
+    TEST_CALLING_RECYCLE_AT<1, 63, 65> (expected) (strf::hex_bytes(bytes, 64));
+}
+
+} // unnamed namespace
+
+STRF_TEST_FUNC void test_input_hex_bytes()
+{
+    const unsigned char bytes[] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x00, 0xFF};
+
+    TEST("")   (strf::hex_bytes(bytes, 0));
+    TEST("")   (strf::hex_bytes(bytes, 0, ':'));
+    TEST("01") (strf::hex_bytes(bytes, 1));
+    TEST("01") (strf::hex_bytes(bytes, 1, ':'));
+
+    TEST ( "0123456789abcdef00ff") (strf::hex_bytes(bytes, 10));
+    TEST (u"0123456789abcdef00ff") (strf::hex_bytes(bytes, 10));
+    TEST (U"0123456789abcdef00ff") (strf::hex_bytes(bytes, 10));
+    TEST (L"0123456789abcdef00ff") (strf::hex_bytes(bytes, 10));
+    TEST ( "0123456789ABCDEF00FF").with(strf::uppercase) (strf::hex_bytes(bytes, 10));
+    TEST ( "0123456789ABCDEF00FF").with(strf::mixedcase) (strf::hex_bytes(bytes, 10));
+    TEST (u"0123456789ABCDEF00FF").with(strf::uppercase) (strf::hex_bytes(bytes, 10));
+
+    TEST ( "01:23:45:67:89:ab:cd:ef:00:ff") (strf::hex_bytes(bytes, 10, ':'));
+    TEST (U"01 23 45 67 89 ab cd ef 00 ff") (strf::hex_bytes(bytes, 10, ' '));
+    TEST ( "01-23-45-67-89-AB-CD-EF-00-FF").with(strf::uppercase)
+        (strf::hex_bytes(bytes, 10, '-'));
+
+    TEST_CALLING_RECYCLE_AT<5, 15> ("0123456789abcdef00ff") (strf::hex_bytes(bytes, 10));
+    TEST_CALLING_RECYCLE_AT<5, 15> (u"0123456789abcdef00ff") (strf::hex_bytes(bytes, 10));
+    TEST_CALLING_RECYCLE_AT<7, 22> ("01:23:45:67:89:ab:cd:ef:00:ff") (strf::hex_bytes(bytes, 10, ':'));
+
+    TEST ("    01:23:45") (strf::right(strf::hex_bytes(bytes, 3, ':'), 12));
+    TEST ("01:23:45****") (strf::left(strf::hex_bytes(bytes, 3, ':'), 12, '*'));
+    TEST ("**01:23:45**") (strf::center(strf::hex_bytes(bytes, 3, ':'), 12, '*'));
+    TEST ("01:23:45")     (strf::right(strf::hex_bytes(bytes, 3, ':'), 5));
+    TEST ("______012345") (strf::join_right(12, '_')(strf::hex_bytes(bytes, 3)));
+
+    test_long_input<char>('\0', strf::lowercase);
+    test_long_input<char>('\0', strf::uppercase);
+    test_long_input<char>(' ', strf::lowercase);
+    test_long_input<char16_t>('\0', strf::uppercase);
+    test_long_input<char32_t>(':', strf::lowercase);
+
+    test_odd_space_at_recycle();
+}
+
+REGISTER_STRF_TEST(test_input_hex_bytes);
@@ -20,6 +20,27 @@ STRF_TEST_FUNC void test_input_ptr()
         (strf::right(ptr, 8, '.'));
 }
 
+STRF_TEST_FUNC void check_forward_writing(unsigned long long x)
+{
+    char forward[24];
+    char backwards[24];
+    const char* fwd_end = strf::detail::write_int_dec_txtdigits_forward(x, forward);
+    const char* bwd_begin = strf::detail::write_int_dec_txtdigits_backwards(x, backwards + 24);
+    const auto len = static_cast<std::size_t>(fwd_end - forward);
+    TEST_EQ(len, static_cast<std::size_t>(backwards + 24 - bwd_begin));
+    TEST_TRUE(strf::detail::str_equal(forward, bwd_begin, len));
+}
+
+#if __cpp_constexpr >= 201304
+
+// count_digits<10> shall remain usable in constant expressions
+static_assert(strf::detail::count_digits<10>(9u) == 1, "");
+static_assert(strf::detail::count_digits<10>(4294967295u) == 10, "");
+static_assert(strf::detail::count_digits<10>(1000000000ull) == 10, "");
+static_assert(strf::detail::count_digits<10>(18446744073709551615ull) == 20, "");
+
+#endif // __cpp_constexpr >= 201304
+
 STRF_TEST_FUNC void test_input_int_no_punct()
 {
     TEST_EQ(1,  strf::detail::count_digits<10>(1ull));
@@ -54,6 +75,55 @@ STRF_TEST_FUNC void test_input_int_no_punct()
     TEST_EQ(9,  strf::detail::count_digits<10>((std::uint32_t)100000000ul));
     TEST_EQ(10, strf::detail::count_digits<10>((std::uint32_t)1000000000ul));
 
+    {   // around each power of ten
+        unsigned long long p10 = 10;
+        for (unsigned n = 1; n < 20; ++n, p10 *= 10) {
+            TEST_EQ(n, strf::detail::count_digits<10>(p10 - 1));
+            TEST_EQ(n + 1, strf::detail::count_digits<10>(p10));
+            if (p10 <= 0xFFFFFFFFull) {
+                TEST_EQ(n, strf::detail::count_digits<10>((std::uint32_t)(p10 - 1)));
+                TEST_EQ(n + 1, strf::detail::count_digits<10>((std::uint32_t)p10));
+            }
+        }
+        TEST_EQ(1,  strf::detail::count_digits<10>(0ull));
+        TEST_EQ(20, strf::detail::count_digits<10>(0xFFFFFFFFFFFFFFFFull));
+        TEST_EQ(1,  strf::detail::count_digits<10>((std::uint32_t)0));
+        TEST_EQ(10, strf::detail::count_digits<10>((std::uint32_t)0xFFFFFFFFul));
+    }
+    {   // around each power of two
+        char buff[30];
+        for (unsigned n = 1; n < 64; ++n) {
+            const unsigned long long x = 1ull << n;
+            const auto len = strf::to(buff) (x).ptr - buff;
+            const auto len_m1 = strf::to(buff) (x - 1).ptr - buff;
+            TEST_EQ(strf::detail::count_digits<10>(x), (unsigned)len);
+            TEST_EQ(strf::detail::count_digits<10>(x - 1), (unsigned)len_m1);
+        }
+    }
+    {   // writing forward and backwards give the same result
+        unsigned long long p10 = 1;
+        for (unsigned n = 0; n < 20; ++n, p10 *= 10) {
+            check_forward_writing(p10 - 1);
+            check_forward_writing(p10);
+            check_forward_writing(p10 + 1);
+            check_forward_writing(p10 / 2 * 3);
+        }
+        check_forward_writing(0xFFFFFFFFFFFFFFFFull);
+        unsigned long long x = 0x2545F4914F6CDD1Dull;
+        for (int i = 0; i < 1000; ++i) {
+            x = x * 6364136223846793005ull + 1442695040888963407ull;
+            check_forward_writing(x >> (x % 64));
+        }
+    }
+    {   // when there is not enough space for the forward writing
+        char buff[8];
+        auto r = strf::to(buff, 7) (-12345);
+        TEST_FALSE(r.truncated);
+        TEST_TRUE(strf::detail::str_equal(buff, "-12345", 7));
+        r = strf::to(buff, 7) (-123456);
+        TEST_TRUE(r.truncated);
+    }
+
     TEST_EQ(1,  strf::detail::count_digits<10>((std::uint16_t)1));
     TEST_EQ(2,  strf::detail::count_digits<10>((std::uint16_t)10));
     TEST_EQ(3,  strf::detail::count_digits<10>((std::uint16_t)100));
@@ -290,6 +360,18 @@ STRF_TEST_FUNC void test_input_int_no_punct()
     TEST("1111111111111111111111111111111111111111111111111111111111111111")
         ( strf::bin(0xffffffffffffffffLL) );
 
+    // digits written in chunks of eight
+    TEST("89abcdef")                 ( strf::hex(0x89abcdef) );
+    TEST("123456789abcdef")          ( strf::hex(0x123456789abcdefLL) );
+    TEST("FEDCBA9876543210").with(strf::uppercase) ( strf::hex(0xfedcba9876543210ULL) );
+    TEST("a5")                       ( strf::hex(static_cast<unsigned char>(0xa5)) );
+    TEST("BEEF").with(strf::uppercase) ( strf::hex(static_cast<unsigned short>(0xbeef)) );
+    TEST("10000001")                 ( strf::bin(static_cast<unsigned char>(0x81)) );
+    TEST("100000001")                ( strf::bin(0x101) );
+    TEST("11111111111111110")        ( strf::bin(0x1fffe) );
+    TEST_CALLING_RECYCLE_AT<5, 9, 19> ("101010101010101010101010101010101")
+        ( strf::bin(0x155555555LL) );
+
     TEST("9")                    ( 9 );
     TEST("99")                   ( 99 );
     TEST("9999")                 ( 9999 );
@@ -555,6 +637,44 @@ STRF_TEST_FUNC void test_input_int_no_punct()
     TEST("  ****12345***") (j(strf::center(12345, 12, '*').fill_sign()));
 }
 
+// A grouping like {g} ( where all groups have size g ) is printed by
+// a dedicated function. {g, g} is equivalent, but takes the general path.
+STRF_TEST_FUNC void check_uniform_grouping(int grp, unsigned long long value)
+{
+    char uniform[80];
+    char general[80];
+    auto uniform_punct = strf::numpunct<10>{grp}.thousands_sep('.');
+    auto general_punct = strf::numpunct<10>{grp, grp}.thousands_sep('.');
+    strf::to(uniform).with(uniform_punct) (strf::punct(value));
+    strf::to(general).with(general_punct) (strf::punct(value));
+    TEST_CSTR_EQ(uniform, general);
+}
+
+STRF_TEST_FUNC void test_uniform_grouping()
+{
+    TEST("1,000").with(strf::numpunct<10>{3})               (strf::punct(1000));
+    TEST("100,200,300").with(strf::numpunct<10>{3})         (strf::punct(100200300));
+    TEST("1,000,001").with(strf::numpunct<10>{3})           (strf::punct(1000001));
+    TEST("-9,000,000").with(strf::numpunct<10>{3})          (strf::punct(-9000000));
+    TEST("18,446,744,073,709,551,615").with(strf::numpunct<10>{3})
+        (strf::punct(0xFFFFFFFFFFFFFFFFULL));
+    TEST("1,2,3,4,5").with(strf::numpunct<10>{1})           (strf::punct(12345));
+    TEST("1,23,45").with(strf::numpunct<10>{2})             (strf::punct(12345));
+    TEST("1,0000,0000").with(strf::numpunct<10>{4})         (strf::punct(100000000));
+    TEST("12345678901234567890").with(strf::numpunct<10>{20})
+        (strf::punct(12345678901234567890ULL));
+
+    const unsigned long long values[] =
+        { 1, 9, 10, 99, 100, 999, 1000, 1001, 9999, 10000, 100000, 999999, 1000000
+        , 1000001, 10010010010ULL, 12345678901234ULL, 999999999999999999ULL
+        , 1000000000000000000ULL, 10000000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL };
+    for (int grp = 1; grp <= 20; ++grp) {
+        for (auto value : values) {
+            check_uniform_grouping(grp, value);
+        }
+    }
+}
+
 template <int Base>
 struct numpunct_maker {
 
@@ -1062,6 +1182,98 @@ STRF_TEST_FUNC void test_input_int_punct()
     }
 }
 
+#if defined(STRF_HAS_INT128)
+
+STRF_TEST_FUNC void test_input_int128()
+{
+    using u128 = strf::detail::uint128_t;
+    using i128 = strf::detail::int128_t;
+
+    const u128 u128_max = ~(u128)0;
+    const i128 i128_max = (i128)(u128_max >> 1);
+    const i128 i128_min = - i128_max - 1;
+    const i128 two_pow_100 = (i128)1 << 100;
+    const u128 e19 = 10000000000000000000ull;
+
+    {   // digits counting and writing around each power of ten
+        u128 p10 = 1;
+        for (unsigned n = 0; n < 39; ++n, p10 *= 10) {
+            if (n > 0) {
+                TEST_EQ(n, strf::detail::count_digits<10>(p10 - 1));
+            }
+            TEST_EQ(n + 1, strf::detail::count_digits<10>(p10));
+
+            char forward[40];
+            char backwards[40];
+            const char* fwd_end = strf::detail::write_int_dec_txtdigits_forward(p10, forward);
+            const char* bwd_begin = strf::detail::write_int_dec_txtdigits_backwards(p10, backwards + 40);
+            TEST_EQ(fwd_end - forward, n + 1);
+            TEST_EQ(backwards + 40 - bwd_begin, n + 1);
+            TEST_TRUE(strf::detail::str_equal(forward, bwd_begin, n + 1));
+        }
+        TEST_EQ(39, strf::detail::count_digits<10>(u128_max));
+        TEST_EQ(32, strf::detail::count_digits<16>(u128_max));
+        TEST_EQ(43, strf::detail::count_digits<8>(u128_max));
+        TEST_EQ(128, strf::detail::count_digits<2>(u128_max));
+        TEST_EQ(26, strf::detail::count_digits<16>((u128)two_pow_100));
+        TEST_EQ(34, strf::detail::count_digits<8>((u128)two_pow_100));
+        TEST_EQ(101, strf::detail::count_digits<2>((u128)two_pow_100));
+    }
+
+    // decimal
+    TEST("340282366920938463463374607431768211455") (u128_max);
+    TEST("170141183460469231731687303715884105727") (i128_max);
+    TEST("-170141183460469231731687303715884105728") (i128_min);
+    TEST("1267650600228229401496703205376") (two_pow_100);
+    TEST("-1267650600228229401496703205376") (-two_pow_100);
+    TEST("50000000000000000007") (e19 * 5 + 7);
+    TEST("100000000000000000000000000000000000000") (e19 * e19);
+    TEST("0 -5 18446744073709551615") ((i128)0, ' ', (i128)-5, ' ', (u128)0xFFFFFFFFFFFFFFFFull);
+    TEST("********-1267650600228229401496703205376") (strf::right(-two_pow_100, 40, '*'));
+    TEST("+0000000001267650600228229401496703205376") (+strf::dec(two_pow_100).p(40));
+    TEST("000340282366920938463463374607431768211455") (strf::dec(u128_max).pad0(42));
+
+    // other bases
+    TEST("ffffffffffffffffffffffffffffffff") (strf::hex(u128_max));
+    TEST("0X10000000000000000000000000") .with(strf::uppercase) (*strf::hex(two_pow_100));
+    TEST("3777777777777777777777777777777777777777777") (strf::oct(u128_max));
+    TEST("0b1000000000000000000000000000000000000000000000000000000000000000000"
+         "0000000000000000000000000000000000") (*strf::bin(two_pow_100));
+    TEST("  0x10000000000000000000000000") (*strf::hex(two_pow_100) > 30);
+
+    // punctuation
+    TEST("340,282,366,920,938,463,463,374,607,431,768,211,455")
+        .with(strf::numpunct<10>{3}) (strf::punct(u128_max));
+    TEST("-170,141,183,460,469,231,731,687,303,715,884,105,728")
+        .with(strf::numpunct<10>{3}) (strf::punct(i128_min));
+    TEST("1701411834604692317316873037158841:05:72:7")
+        .with(strf::numpunct<10>{1, 2, 2, -1}.thousands_sep(':')) (strf::punct(i128_max));
+    TEST("    +001,267,650,600,228,229,401,496,703,205,376")
+        .with(strf::numpunct<10>{3}) (+strf::punct(two_pow_100).pad0(44) > 48);
+    TEST(u"340\u2022282\u2022366\u2022920\u2022938\u2022463\u2022463\u2022374"
+         u"\u2022607\u2022431\u2022768\u2022211\u2022455")
+        .with(strf::numpunct<10>{3}.thousands_sep(0x2022)) (strf::punct(u128_max));
+    TEST("10'0000'0000'0000'0000'0000'0000")
+        .with(strf::numpunct<16>{4}.thousands_sep('\'')) (strf::punct(strf::hex(two_pow_100)));
+
+    // full dynamic
+    TEST("ffffffffffffffffffffffffffffffff") (strf::fmt(u128_max).base(16));
+    TEST("-170,141,183,460,469,231,731,687,303,715,884,105,728")
+        .with(strf::numpunct<10>{3}) (strf::fmt(i128_min).base(10).punct());
+
+    // after other arguments, so that the printer is not placed at the
+    // beginning of the tuple ( this used to be misaligned )
+    static_assert( alignof(strf::detail::int_printer_full_dynamic<char, u128>)
+                   >= alignof(u128), "" );
+    TEST("a1340,282,366,920,938,463,463,374,607,431,768,211,455")
+        .with(strf::numpunct<10>{3})
+        ('a', 1, strf::fmt(u128_max).base(10).punct());
+    TEST("a10x80000000000000000000000000000000")
+        ('a', (short)1, *strf::fmt(i128_min).base(16));
+}
+
+#endif // defined(STRF_HAS_INT128)
+
 } // unnamed namespace
 
 STRF_TEST_FUNC void test_input_int()
@@ -1069,6 +1281,10 @@ STRF_TEST_FUNC void test_input_int()
     test_input_ptr();
     test_input_int_no_punct();
     test_input_int_punct();
+    test_uniform_grouping();
+#if defined(STRF_HAS_INT128)
+    test_input_int128();
+#endif
 }
 
 REGISTER_STRF_TEST(test_input_int);
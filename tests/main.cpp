@@ -35,6 +35,7 @@ void test_input_bool();
 void test_input_char();
 void test_input_char32();
 void test_input_float();
+void test_input_hex_bytes();
 void test_input_int();
 void test_input_string();
 void test_input_facets_pack();
@@ -60,11 +61,18 @@ void test_utf32();
 void test_single_byte_charsets();
 void test_cstr_writer();
 void test_locale();
+void test_async_cfile_writer();
 void test_cfile_writer();
+void test_chunked_writer();
+void test_fd_writer();
+void test_mmap_file_writer();
+void test_pooled_string();
+void test_ring_buffer_writer();
 void test_destination_functions();
 void test_printable_overriding();
 void test_streambuf_writer();
 void test_string_writer();
+void test_uring_fd_writer();
 void test_to_range();
 
 int main() {
@@ -74,9 +82,16 @@ int main() {
 #if ! defined(STRF_FREESTANDING)
 
     test_locale();
+    test_async_cfile_writer();
     test_cfile_writer();
+    test_chunked_writer();
+    test_fd_writer();
+    test_mmap_file_writer();
+    test_pooled_string();
+    test_ring_buffer_writer();
     test_streambuf_writer();
     test_string_writer();
+    test_uring_fd_writer();
 
 #endif // ! defined(STRF_FREESTANDING)
 
@@ -93,6 +108,7 @@ int main() {
     test_input_char32();
     test_input_facets_pack();
     test_input_float();
+    test_input_hex_bytes();
     test_input_int();
     test_input_range();
     test_input_string();
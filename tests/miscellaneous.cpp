@@ -33,6 +33,20 @@ STRF_TEST_FUNC void test_miscellaneous()
         dest.write(buff, sizeof(buff)/sizeof(buff[0]));
         TEST_FALSE(dest.good());
     }
+    {   // test size_counter
+        strf::size_counter<char> dest;
+        TEST_TRUE(dest.good());
+        TEST_EQ(dest.count(), 0);
+        strf::to(dest) ("abc", 123);
+        TEST_EQ(dest.count(), 6);
+        dest.recycle();
+        TEST_TRUE(dest.buffer_space() >= strf::min_space_after_recycle<char>());
+        char buff[200] = {};
+        dest.write(buff, sizeof(buff)/sizeof(buff[0]));
+        strf::to(dest) (strf::multi('x', 1000));
+        TEST_TRUE(dest.good());
+        TEST_EQ(dest.finish(), 1206);
+    }
     {   // preview size
         strf::print_preview<strf::preview_size::yes, strf::preview_width::no> p;
 
@@ -0,0 +1,145 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_utils.hpp"
+
+#if ! defined(_WIN32)
+
+#include <strf/to_mmap_file.hpp>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+template <typename CharT>
+void test_writing_several_windows()
+{
+    auto half_str = test_utils::make_half_string<CharT>();
+    auto long_str = test_utils::make_random_std_string<CharT>(20000);
+
+    auto path = test_utils::unique_tmp_file_name();
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+
+    // the smallest possible window, so that it needs to be moved many times
+    strf::mmap_file_writer<CharT> writer(fd, 1);
+    std::basic_string<CharT> expected_content;
+    for (int i = 0; i < 10; ++i) {
+        writer.write(half_str.begin(), half_str.size());
+        writer.write(long_str.data(), long_str.size());
+        strf::to(writer) (strf::multi(static_cast<CharT>('x'), 5000));
+
+        expected_content.append(half_str.begin(), half_str.size());
+        expected_content.append(long_str);
+        expected_content.append(5000, static_cast<CharT>('x'));
+    }
+    auto status = writer.finish();
+    ::close(fd);
+    auto obtained_content = test_utils::read_file<CharT>(path.c_str());
+    std::remove(path.c_str());
+
+    TEST_TRUE(status.success);
+    TEST_EQ(status.error, 0);
+    TEST_EQ(status.count, expected_content.size());
+    TEST_EQ(obtained_content.size(), expected_content.size());
+    TEST_TRUE(obtained_content == expected_content);
+}
+
+template <typename CharT>
+void test_mmap_file_writer_creator()
+{
+    auto half_str = test_utils::make_half_string<CharT>();
+    auto long_str = test_utils::make_random_std_string<CharT>(5000);
+
+    std::basic_string<CharT> expected_content;
+    expected_content.append(half_str.begin(), half_str.size());
+    expected_content.append(long_str);
+    expected_content.append(half_str.begin(), half_str.size());
+
+    auto path = test_utils::unique_tmp_file_name();
+    {   // without size pre-calculation
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+        auto status = strf::to_mmap_file<CharT>(fd) (half_str, long_str, half_str);
+        ::close(fd);
+        auto obtained_content = test_utils::read_file<CharT>(path.c_str());
+
+        TEST_TRUE(status.success);
+        TEST_EQ(status.count, expected_content.size());
+        TEST_TRUE(obtained_content == expected_content);
+    }
+    {   // with size pre-calculation, overwriting a bigger file
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0600);
+        auto status = strf::to_mmap_file<CharT>(fd) .reserve_calc()
+            (half_str, long_str);
+        ::close(fd);
+        auto obtained_content = test_utils::read_file<CharT>(path.c_str());
+
+        TEST_TRUE(status.success);
+        TEST_EQ(status.count, half_str.size() + long_str.size());
+        TEST_TRUE(obtained_content == expected_content.substr(0, status.count));
+    }
+    {   // with a given size that is too small
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+        auto status = strf::to_mmap_file<CharT>(fd) .reserve(10)
+            (half_str, long_str, half_str);
+        ::close(fd);
+        auto obtained_content = test_utils::read_file<CharT>(path.c_str());
+
+        TEST_TRUE(status.success);
+        TEST_EQ(status.count, expected_content.size());
+        TEST_TRUE(obtained_content == expected_content);
+    }
+    std::remove(path.c_str());
+}
+
+void test_failing_to_map()
+{
+    auto path = test_utils::unique_tmp_file_name();
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    auto status = strf::to_mmap_file(fd) ("abc");
+    ::close(fd);
+    auto obtained_content = test_utils::read_file<char>(path.c_str());
+    std::remove(path.c_str());
+
+    TEST_FALSE(status.success);
+    TEST_EQ(status.count, 0);
+    TEST_EQ(status.error, EACCES);
+    TEST_EQ(obtained_content.size(), 0);
+}
+
+void test_when_finish_is_not_called()
+{
+    auto path = test_utils::unique_tmp_file_name();
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    {
+        strf::mmap_file_writer<char> writer(fd);
+        strf::to(writer) ("abc", 123);
+    }
+    ::close(fd);
+    auto obtained_content = test_utils::read_file<char>(path.c_str());
+    std::remove(path.c_str());
+
+    TEST_TRUE(obtained_content == "abc123");
+}
+
+void test_mmap_file_writer()
+{
+    test_writing_several_windows<char>();
+    test_writing_several_windows<char16_t>();
+    test_writing_several_windows<char32_t>();
+
+    test_mmap_file_writer_creator<char>();
+    test_mmap_file_writer_creator<char16_t>();
+    test_mmap_file_writer_creator<wchar_t>();
+
+    test_failing_to_map();
+    test_when_finish_is_not_called();
+}
+
+#else // ! defined(_WIN32)
+
+void test_mmap_file_writer()
+{
+}
+
+#endif // ! defined(_WIN32)
@@ -0,0 +1,162 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_utils.hpp"
+#include <strf/to_pooled_string.hpp>
+#include <thread>
+
+template <typename CharT>
+static void test_pooled_string_maker()
+{
+    const auto tiny_str = test_utils::make_tiny_string<CharT>();
+    const auto half_str = test_utils::make_half_string<CharT>();
+    const auto long_str = test_utils::make_random_std_string<CharT>(5000);
+
+    {   // when nothing is written
+        strf::basic_pooled_string_maker<CharT> dest;
+        TEST_TRUE(dest.finish().empty());
+    }
+    {   // when neither recycle() nor do_write() is called
+        strf::basic_pooled_string_maker<CharT> dest;
+        dest.write(tiny_str.begin(), tiny_str.size());
+        auto str = dest.finish();
+        TEST_TRUE(str == std::basic_string<CharT>(tiny_str.begin(), tiny_str.end()));
+    }
+    {   // when recycle() is called
+        std::basic_string<CharT> expected;
+        strf::basic_pooled_string_maker<CharT> dest;
+        while (expected.size() < 1000) {
+            strf::detail::copy_n(half_str.begin(), dest.buffer_space(), dest.buffer_ptr());
+            expected.append(half_str.begin(), dest.buffer_space());
+            dest.advance(dest.buffer_space());
+            dest.recycle();
+            TEST_TRUE(dest.good());
+            TEST_TRUE(dest.buffer_space() >= strf::min_space_after_recycle<CharT>());
+        }
+        TEST_TRUE(dest.finish() == expected);
+    }
+    {   // when do_write() is called
+        strf::basic_pooled_string_maker<CharT> dest;
+        dest.write(half_str.begin(), half_str.size());
+        dest.write(long_str.data(), long_str.size());
+        dest.write(tiny_str.begin(), tiny_str.size());
+
+        std::basic_string<CharT> expected{half_str.begin(), half_str.end()};
+        expected.append(long_str);
+        expected.append(tiny_str.begin(), tiny_str.end());
+        TEST_TRUE(dest.finish() == expected);
+    }
+    {   // creator, without and with size pre-calculation
+        std::basic_string<CharT> expected{half_str.begin(), half_str.end()};
+        expected.append(long_str);
+        expected.append(half_str.begin(), half_str.end());
+
+        using creator_t = strf::detail::basic_pooled_string_maker_creator<CharT>;
+        auto str = strf::destination_no_reserve<creator_t>() (half_str, long_str, half_str);
+        TEST_TRUE(str == expected);
+
+        str = strf::destination_no_reserve<creator_t>()
+            .reserve_calc() (half_str, long_str, half_str);
+        TEST_TRUE(str == expected);
+    }
+}
+
+static void test_statistics()
+{
+    strf::release_pooled_string_buffer();
+    strf::reset_pooled_string_statistics();
+    auto stats = strf::pooled_string_statistics();
+    TEST_EQ(stats.calls, 0);
+    TEST_EQ(stats.capacity, 0);
+
+    for (int i = 0; i < 10; ++i) {
+        auto str = strf::to_pooled_string("abc", i);
+        TEST_EQ(str.size(), 4);
+    }
+    stats = strf::pooled_string_statistics();
+    TEST_EQ(stats.calls, 10);
+    TEST_EQ(stats.hits, 10);
+    TEST_EQ(stats.grows, 0);
+    TEST_EQ(stats.nested, 0);
+    TEST_EQ(stats.capacity, strf::pooled_string_maker::initial_capacity);
+
+    // the scratch buffer grows and keeps its capacity for the next calls
+    const std::string medium_str(1000, 'x');
+    auto str = strf::to_pooled_string(medium_str, medium_str, medium_str);
+    TEST_EQ(str.size(), 3000);
+    stats = strf::pooled_string_statistics();
+    TEST_EQ(stats.calls, 11);
+    TEST_EQ(stats.hits, 10);
+    TEST_TRUE(stats.grows > 0);
+    TEST_TRUE(stats.capacity >= 3000);
+
+    const auto grows = stats.grows;
+    str = strf::to_pooled_string(medium_str, medium_str, medium_str);
+    TEST_EQ(str.size(), 3000);
+    stats = strf::pooled_string_statistics();
+    TEST_EQ(stats.calls, 12);
+    TEST_EQ(stats.hits, 11);
+    TEST_EQ(stats.grows, grows);
+
+    // with size pre-calculation, the scratch buffer is not used
+    str = strf::to_pooled_string.reserve_calc() (medium_str);
+    TEST_EQ(str.size(), 1000);
+    TEST_EQ(strf::pooled_string_statistics().calls, 12);
+
+    // a string bigger than max_pooled_capacity does not stay in the pool
+    const auto capacity = stats.capacity;
+    constexpr auto max_capacity = strf::pooled_string_maker::max_pooled_capacity;
+    str = strf::to_pooled_string(strf::multi('y', max_capacity * 2));
+    TEST_EQ(str.size(), max_capacity * 2);
+    stats = strf::pooled_string_statistics();
+    TEST_TRUE(stats.capacity <= max_capacity);
+    TEST_TRUE(stats.capacity >= capacity);
+
+    strf::release_pooled_string_buffer();
+    TEST_EQ(strf::pooled_string_statistics().capacity, 0);
+}
+
+static void test_nested_use()
+{
+    strf::reset_pooled_string_statistics();
+    strf::pooled_string_maker outer;
+    strf::to(outer) ("outer ");
+    auto inner = strf::to_pooled_string("inner ", 123);
+    strf::to(outer) (inner, 456);
+
+    TEST_TRUE(inner == "inner 123");
+    TEST_TRUE(outer.finish() == "outer inner 123456");
+
+    auto stats = strf::pooled_string_statistics();
+    TEST_EQ(stats.calls, 2);
+    TEST_EQ(stats.nested, 1);
+    TEST_EQ(stats.hits, 1);
+}
+
+static void test_separate_threads()
+{
+    strf::reset_pooled_string_statistics();
+    std::size_t other_thread_calls = 0;
+    std::thread t{[&other_thread_calls](){
+        auto str = strf::to_pooled_string("abc");
+        TEST_TRUE(str == "abc");
+        other_thread_calls = strf::pooled_string_statistics().calls;
+    }};
+    t.join();
+    TEST_EQ(other_thread_calls, 1);
+    TEST_EQ(strf::pooled_string_statistics().calls, 0);
+}
+
+void test_pooled_string()
+{
+    test_pooled_string_maker<char>();
+    test_pooled_string_maker<char16_t>();
+    test_pooled_string_maker<char32_t>();
+    test_pooled_string_maker<wchar_t>();
+
+    test_statistics();
+    test_nested_use();
+    test_separate_threads();
+}
@@ -70,6 +70,63 @@ constexpr auto STRF_HD reservation_test()
     return {};
 }
 
+namespace {
+
+// Prints bool as "yes" or "no", but does not implement the size preview
+template <typename CharT>
+class bool_printer_without_preview: public strf::printer<CharT>
+{
+public:
+
+    template <typename... T>
+    STRF_HD bool_printer_without_preview(const strf::usual_printer_input<T...>& input)
+        : value_(input.arg)
+    {
+    }
+
+    void STRF_HD print_to(strf::destination<CharT>& dest) const override
+    {
+        dest.ensure(3);
+        auto p = dest.buffer_ptr();
+        if (value_) {
+            p[0] = static_cast<CharT>('y');
+            p[1] = static_cast<CharT>('e');
+            p[2] = static_cast<CharT>('s');
+            dest.advance(3);
+        } else {
+            p[0] = static_cast<CharT>('n');
+            p[1] = static_cast<CharT>('o');
+            dest.advance(2);
+        }
+    }
+
+private:
+
+    bool value_;
+};
+
+struct bool_override_without_preview
+{
+    using category = strf::print_override_c;
+
+    template <typename CharT, typename Preview, typename FPack>
+    constexpr static STRF_HD auto make_printer_input
+        ( strf::tag<CharT>
+        , Preview& preview
+        , const FPack& fp
+        , bool x ) noexcept
+        -> strf::usual_printer_input
+            < CharT, Preview, FPack, bool, bool_printer_without_preview<CharT> >
+    {
+        return {preview, fp, x};
+    }
+};
+
+template <typename T>
+struct is_bool: std::is_same<T, bool> {};
+
+} // unnamed namespace
+
 
 STRF_TEST_FUNC void test_reserve()
 {
@@ -142,6 +199,40 @@ STRF_TEST_FUNC void test_reserve()
         auto size = std::move(tester).reserve_calc() ("abcd");
         TEST_EQ(size, 4);
     }
+
+    // reserve_calc_by_dry_run
+
+    {
+        auto size = reservation_test() .reserve_calc_by_dry_run() ("abcd", 1234);
+        TEST_EQ(size, 8);
+    }
+    {
+        auto tester = reservation_test() .reserve(5555);
+        auto size = tester.reserve_calc_by_dry_run() ("abcd");
+        TEST_EQ(size, 4);
+        size = tester.reserve_calc_by_dry_run().reserve_calc_by_dry_run() ("abcd");
+        TEST_EQ(size, 4);
+        size = tester.reserve_calc_by_dry_run().no_reserve() ("abcd");
+        TEST_EQ(size, not_reserved);
+    }
+    {
+        const auto tester = reservation_test() .reserve_calc_by_dry_run();
+        auto size = tester ("abcd");
+        TEST_EQ(size, 4);
+        size = std::move(tester) .tr("{} {}", "abcd", 123);
+        TEST_EQ(size, 8);
+    }
+    {   // larger than the buffer of size_counter
+        auto size = reservation_test() .reserve_calc_by_dry_run()
+            (strf::multi('x', 5000), "abc", strf::right(1, 3000));
+        TEST_EQ(size, 8003);
+    }
+    {   // with a printer that does not implement the size preview
+        auto tester = reservation_test()
+            .with(strf::constrain<is_bool>(bool_override_without_preview{}));
+        TEST_EQ(tester.reserve_calc() (true, "abcd"), 4);
+        TEST_EQ(tester.reserve_calc_by_dry_run() (true, "abcd"), 7);
+    }
 }
 
 REGISTER_STRF_TEST(test_reserve);
@@ -0,0 +1,274 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_utils.hpp"
+#include <strf/to_ring_buffer.hpp>
+#include <strf/to_string.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if ! defined(_WIN32)
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace {
+
+std::vector<std::string> consume_all(strf::ring_buffer& ring)
+{
+    std::vector<std::string> records;
+    ring.consume([&records](const char* data, std::size_t size) {
+        records.emplace_back(data, size);
+    });
+    return records;
+}
+
+void test_records_are_consumed_in_order()
+{
+    strf::ring_buffer ring(4096);
+    TEST_EQ(ring.capacity(), 4096);
+
+    auto r = strf::to(ring) ("abc", 123);
+    TEST_TRUE(r.success);
+    TEST_FALSE(r.truncated);
+    TEST_EQ(r.count, 6);
+    strf::to(ring) ("");
+    strf::to(ring) .reserve_calc() ("def", 456);
+    {
+        strf::ring_buffer_writer writer(ring);
+        strf::to(writer) ("ghi");
+        // not committed until finish() or the destructor
+        TEST_EQ(consume_all(ring).size(), 3);
+    }
+    auto records = consume_all(ring);
+    TEST_EQ(records.size(), 1);
+    TEST_TRUE(records[0] == "ghi");
+    TEST_EQ(consume_all(ring).size(), 0);
+    TEST_EQ(ring.dropped_count(), 0);
+}
+
+void test_uncommitted_record_blocks_the_following_ones()
+{
+    strf::ring_buffer ring(4096);
+    strf::to(ring) ("first");
+    strf::ring_buffer_writer writer(ring);
+    strf::to(ring) ("third");
+
+    auto records = consume_all(ring);
+    TEST_EQ(records.size(), 1);
+    TEST_TRUE(records[0] == "first");
+
+    strf::to(writer) ("second");
+    writer.finish();
+    records = consume_all(ring);
+    TEST_EQ(records.size(), 2);
+    TEST_TRUE(records[0] == "second");
+    TEST_TRUE(records[1] == "third");
+}
+
+void test_wrapping_around()
+{
+    strf::ring_buffer ring(1024);
+    std::size_t expected_id = 0;
+    for (std::size_t i = 0; i < 2000; ++i) {
+        auto r = strf::to(ring) ("record ", i, ' ', strf::multi('x', i % 100));
+        TEST_TRUE(r.success);
+        if (i % 4 == 3) {
+            for (const auto& rec : consume_all(ring)) {
+                auto expected = strf::to_string
+                    ("record ", expected_id, ' ', strf::multi('x', expected_id % 100));
+                TEST_TRUE(rec == expected);
+                ++expected_id;
+            }
+        }
+    }
+    expected_id += consume_all(ring).size();
+    TEST_EQ(expected_id, 2000);
+}
+
+void test_enlarging_and_truncating_the_slot()
+{
+    strf::ring_buffer ring(4096);
+    const std::string str(200, 'a');
+    {   // the slot is enlarged when no other slot was reserved after it
+        strf::ring_buffer_writer writer(ring, 16);
+        strf::to(writer) (str, str, str);
+        auto r = writer.finish();
+        TEST_TRUE(r.success);
+        TEST_EQ(r.count, 600);
+    }
+    auto records = consume_all(ring);
+    TEST_EQ(records.size(), 1);
+    TEST_TRUE(records[0] == str + str + str);
+    {   // otherwise, the record is truncated
+        strf::ring_buffer_writer writer(ring, 100);
+        strf::to(ring) ("next");
+        strf::to(writer) (str);
+        auto r = writer.finish();
+        TEST_FALSE(r.success);
+        TEST_TRUE(r.truncated);
+        TEST_EQ(r.count, 100);
+    }
+    records = consume_all(ring);
+    TEST_EQ(records.size(), 2);
+    TEST_TRUE(records[0] == str.substr(0, 100));
+    TEST_TRUE(records[1] == "next");
+    {   // a record can not be larger than max_record_size()
+        auto r = strf::to(ring) (strf::multi('b', 5000));
+        TEST_TRUE(r.truncated);
+        TEST_EQ(r.count, ring.max_record_size());
+    }
+    consume_all(ring);
+}
+
+void test_full_ring()
+{
+    strf::ring_buffer ring(1024);
+    std::size_t committed = 0;
+    for (int i = 0; i < 100; ++i) {
+        committed += strf::to(ring) .reserve_calc() (strf::multi('x', 56)) .success;
+    }
+    // each slot takes 64 bytes
+    TEST_EQ(committed, 16);
+    TEST_EQ(ring.dropped_count(), 84);
+    TEST_EQ(consume_all(ring).size(), 16);
+
+    auto r = strf::to(ring) ("abc");
+    TEST_TRUE(r.success);
+}
+
+void test_head_moved_backwards_while_consuming()
+{
+    // The consumer takes a snapshot of the head, but then a short record
+    // gives back the unused part of the last slot, and new records are
+    // placed there, until the ring is full. Each record must still be
+    // consumed exactly once.
+    strf::ring_buffer ring(1024);
+    strf::to(ring) .reserve_calc() ("p");
+    // the slot ends at the position 120, which is not the
+    // beginning of any of the 16 bytes slots reserved below
+    strf::ring_buffer_writer writer(ring, 96);
+    std::vector<std::string> records;
+    std::size_t filled = 0;
+    ring.consume([&](const char* data, std::size_t size) {
+        if (records.empty()) {
+            strf::to(writer) ("r");
+            writer.finish();
+            // one character records take 16 bytes, so the ring becomes
+            // exactly full
+            while (strf::to(ring) .reserve_calc() (static_cast<char>('a' + filled % 26)).success) {
+                ++filled;
+            }
+        }
+        records.emplace_back(data, size);
+    });
+    for (auto& rec : consume_all(ring)) {
+        records.push_back(std::move(rec));
+    }
+    TEST_EQ(ring.dropped_count(), 1);
+    TEST_EQ(filled, 62);
+    TEST_EQ(records.size(), filled + 2);
+    if (records.size() == filled + 2) {
+        TEST_TRUE(records[0] == "p");
+        TEST_TRUE(records[1] == "r");
+        for (std::size_t i = 0; i < filled; ++i) {
+            TEST_TRUE(records[i + 2] == std::string(1, static_cast<char>('a' + i % 26)));
+        }
+    }
+    TEST_EQ(consume_all(ring).size(), 0);
+}
+
+void test_many_producers()
+{
+    constexpr int producers_count = 4;
+    constexpr int records_per_producer = 20000;
+
+    strf::ring_buffer ring(1 << 14);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producers_count; ++p) {
+        producers.emplace_back([&ring, p]() {
+            for (int i = 0; i < records_per_producer; ++i) {
+                while ( ! strf::to(ring) (p, ' ', i, ' ', strf::multi('z', i % 50)).success) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> next_id(producers_count, 0);
+    int received = 0;
+    bool ok = true;
+    while (received < producers_count * records_per_producer) {
+        ring.consume([&](const char* data, std::size_t size) {
+            int p = data[0] - '0';
+            auto expected = strf::to_string
+                (p, ' ', next_id[p], ' ', strf::multi('z', next_id[p] % 50));
+            ok = ok && expected == std::string(data, size);
+            ++next_id[p];
+            ++received;
+        });
+        std::this_thread::yield();
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+    TEST_TRUE(ok);
+    for (int p = 0; p < producers_count; ++p) {
+        TEST_EQ(next_id[p], records_per_producer);
+    }
+}
+
+#if ! defined(_WIN32)
+
+void test_drain_to_fd()
+{
+    strf::ring_buffer ring(1 << 16);
+    std::string expected;
+    for (int i = 0; i < 500; ++i) {
+        strf::to(ring) ("line ", i, '\n');
+        strf::append(expected) ("line ", i, '\n');
+    }
+    auto path = test_utils::unique_tmp_file_name();
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    auto r = ring.drain_to_fd(fd);
+    ::close(fd);
+    auto obtained = test_utils::read_file<char>(path.c_str());
+    std::remove(path.c_str());
+
+    TEST_TRUE(r.success);
+    TEST_EQ(r.error, 0);
+    TEST_EQ(r.records, 500);
+    TEST_EQ(r.bytes, expected.size());
+    TEST_TRUE(obtained == expected);
+
+    // the records are released even when writing fails
+    strf::to(ring) ("abc");
+    fd = ::open("/dev/null", O_RDONLY);
+    r = ring.drain_to_fd(fd);
+    ::close(fd);
+    TEST_FALSE(r.success);
+    TEST_EQ(r.error, EBADF);
+    TEST_EQ(r.records, 1);
+    TEST_EQ(consume_all(ring).size(), 0);
+}
+
+#endif // ! defined(_WIN32)
+
+} // unnamed namespace
+
+void test_ring_buffer_writer()
+{
+    test_records_are_consumed_in_order();
+    test_uncommitted_record_blocks_the_following_ones();
+    test_wrapping_around();
+    test_enlarging_and_truncating_the_slot();
+    test_full_ring();
+    test_head_moved_backwards_while_consuming();
+    test_many_producers();
+#if ! defined(_WIN32)
+    test_drain_to_fd();
+#endif
+}
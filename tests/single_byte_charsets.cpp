@@ -1351,6 +1351,66 @@ inline STRF_HD void test_undefined_bytes
         (strf::sani(undefined_bytes, charset));
 }
 
+template <typename SrcCharset, typename DestCharset>
+STRF_HD void test_single_byte_to_single_byte(SrcCharset src_cs, DestCharset dest_cs)
+{
+    TEST_SCOPE_DESCRIPTION(src_cs.name(), " to ", dest_cs.name());
+
+    char buff_str_0_to_xff[0x100];
+    for(unsigned i = 0; i < 0x100; ++i) {
+        buff_str_0_to_xff[i] = static_cast<char>(i);
+    }
+    strf::detail::simple_string_view<char> str_0_to_xff{buff_str_0_to_xff, 0x100};
+
+    // the expected result is obtained passing through UTF-32
+    char32_t buff_u32[0x101];
+    auto res_u32 = strf::to(buff_u32) (strf::conv(str_0_to_xff, src_cs));
+    char buff_expected[0x101];
+    strf::detail::simple_string_view<char32_t> str_u32{buff_u32, res_u32.ptr};
+    auto res_expected = strf::to(buff_expected) .with(dest_cs)
+        (strf::conv(str_u32, strf::utf_t<char32_t>()));
+    strf::detail::simple_string_view<char> expected{buff_expected, res_expected.ptr};
+    TEST_EQ(expected.size(), 0x100);
+
+    unsigned invalid_count = 0;
+    for(unsigned i = 0; i < 0x100; ++i) {
+        if (expected[i] == '?' && i != '?') {
+            ++invalid_count;
+        }
+    }
+
+    auto transc = strf::find_transcoder(src_cs, dest_cs);
+    TEST_TRUE(transc.transcode_func() != nullptr);
+
+    TEST(expected) .with(dest_cs) (strf::conv(str_0_to_xff, src_cs));
+
+    ::encoding_error_handler_calls() = 0;
+    TEST(expected)
+        .with(dest_cs, strf::invalid_seq_notifier{encoding_error_handler})
+        (strf::conv(str_0_to_xff, src_cs));
+    TEST_EQ(::encoding_error_handler_calls(), invalid_count);
+
+    {   // cover recycle ( skipping '\0' )
+        char expected_1_to_150[151];
+        strf::to(expected_1_to_150) (strf::detail::simple_string_view<char>{buff_expected + 1, 150});
+        strf::detail::simple_string_view<char> str_1_to_xff{buff_str_0_to_xff + 1, 0xFF};
+        TEST_CALLING_RECYCLE_AT<100, 50>(expected_1_to_150)
+            .with(dest_cs) (strf::conv(str_1_to_xff, src_cs));
+    }
+
+    {   // using dynamic charsets
+        auto src_data = src_cs.make_data();
+        auto dest_data = dest_cs.make_data();
+        strf::dynamic_charset<char> src_dyn_cs{src_data};
+        strf::dynamic_charset<char> dest_dyn_cs{dest_data};
+
+        auto dyn_transc = src_dyn_cs.find_transcoder_to(strf::tag<char>{}, dest_cs.id());
+        TEST_TRUE(dyn_transc.transcode_func() == transc.transcode_func());
+
+        TEST(expected) .with(dest_dyn_cs) (strf::conv(str_0_to_xff, src_dyn_cs));
+    }
+}
+
 } // unnamed namespace
 
 STRF_TEST_FUNC void test_single_byte_charsets()
@@ -1434,7 +1494,7 @@ STRF_TEST_FUNC void test_single_byte_charsets()
     test_unsupported_codepoints( strf::windows_1253_t<char>{}
                                , { 0x80, 0x82, 0xAA, 0xD2, 0xFF, 0x20AB, 0x20AD, 0x2123 } );
     test_unsupported_codepoints( strf::windows_1254_t<char>{}
-                               , { 0x80, 0x2121, 0x2123 } );
+                               , { 0x80, 0xD0, 0xDD, 0xDE, 0xF0, 0xFD, 0xFE, 0x2121, 0x2123 } );
     test_unsupported_codepoints( strf::windows_1255_t<char>{}
                                , { 0x80, 0xD9, 0xDF, 0x2121, 0x2123 } );
     test_unsupported_codepoints( strf::windows_1256_t<char>{}
@@ -1442,10 +1502,20 @@ STRF_TEST_FUNC void test_single_byte_charsets()
     test_unsupported_codepoints( strf::windows_1257_t<char>{}
                                , { 0x80, 0xA1, 0xA5, 0x2121, 0x2123 } );
     test_unsupported_codepoints( strf::windows_1258_t<char>{}
-                               , { 0x80, 0x2121, 0x2123 } );
+                               , { 0x80, 0x9F, 0x2121, 0x2123 } );
+
+    test_single_byte_to_single_byte(strf::windows_1252_t<char>{}, strf::iso_8859_1_t<char>{});
+    test_single_byte_to_single_byte(strf::iso_8859_1_t<char>{}, strf::windows_1252_t<char>{});
+    test_single_byte_to_single_byte(strf::windows_1252_t<char>{}, strf::iso_8859_15_t<char>{});
+    test_single_byte_to_single_byte(strf::iso_8859_15_t<char>{}, strf::windows_1250_t<char>{});
+    test_single_byte_to_single_byte(strf::windows_1251_t<char>{}, strf::iso_8859_5_t<char>{});
+    test_single_byte_to_single_byte(strf::iso_8859_6_t<char>{}, strf::windows_1256_t<char>{});
+    test_single_byte_to_single_byte(strf::iso_8859_8_t<char>{}, strf::windows_1255_t<char>{});
+    test_single_byte_to_single_byte(strf::iso_8859_11_t<char>{}, strf::ascii_t<char>{});
+    test_single_byte_to_single_byte(strf::ascii_t<char>{}, strf::windows_1258_t<char>{});
 
    {
-       // transcoding a large string to cover detail::buffered_encoder::recycle()
+       // transcoding a large string between single-byte charsets
        const char* win1256_str =
            "abcdefghijklmnopqrstuvwxyz 0123456789 ----- !@#$%&*()"
            "__\xD8\xD9\xDA\xDB\xDC\xDD\xDE\xDF \xE1\xE3 \xE4 \xEC\xED"
@@ -1470,6 +1540,45 @@ STRF_TEST_FUNC void test_single_byte_charsets()
 
        TEST(iso8859_6_str) .with(strf::iso_8859_6_t<char>{})
            (strf::conv(win1256_str, strf::windows_1256_t<char>{}));
+
+       // transcoding a large string to cover detail::buffered_encoder::recycle()
+       // ( decode_encode is called explicitly, since conv now uses
+       //   the direct transcoder from windows-1256 to iso-8859-6 )
+       char buff[400];
+       strf::basic_cstr_writer<char> dest(buff);
+       strf::decode_encode<char, char>
+           ( dest
+           , strf::windows_1256_t<char>{}.to_u32().transcode_func()
+           , strf::iso_8859_6_t<char>{}.from_u32().transcode_func()
+           , win1256_str
+           , strf::detail::str_length(win1256_str)
+           , strf::invalid_seq_notifier{}
+           , strf::surrogate_policy::strict );
+       dest.finish();
+       TEST_CSTR_EQ(buff, iso8859_6_str);
+   }
+   {
+       // encoding a long string from UTF-32 with ASCII and non-ASCII runs
+       const char32_t* u32str =
+           U"abcdefghijklmnopqrstuvwxyz 0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+           U"\u20AC\u00E9 abcdefghijklmnopqrstuvwxyz \u0160\u2122"
+           U"0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ abcdefghijklmnopqrstuvwxyz"
+           U"\u0100 abcdefghijklmnopqrstuvwxyz 0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+       const char* expected =
+           "abcdefghijklmnopqrstuvwxyz 0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+           "\x80\xE9 abcdefghijklmnopqrstuvwxyz \x8A\x99"
+           "0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ abcdefghijklmnopqrstuvwxyz"
+           "? abcdefghijklmnopqrstuvwxyz 0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+       TEST(expected) .with(strf::windows_1252_t<char>{}) (strf::conv(u32str));
+       TEST_CALLING_RECYCLE_AT<30, 200>(expected)
+           .with(strf::windows_1252_t<char>{}) (strf::conv(u32str));
+
+       ::encoding_error_handler_calls() = 0;
+       TEST(expected)
+           .with(strf::windows_1252_t<char>{}, strf::invalid_seq_notifier{encoding_error_handler})
+           (strf::conv(u32str));
+       TEST_EQ(::encoding_error_handler_calls(), 1);
    }
 }
 
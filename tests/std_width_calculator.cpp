@@ -1600,6 +1600,114 @@ STRF_HD void other_tests()
     }
 }
 
+// Evaluates the width in the way std_width_calc_t does for dynamic
+// charsets and when it does not use the fast path for printable ASCII
+template <typename Charset>
+STRF_HD strf::width_and_pos width_and_pos_by_decrementer
+    ( Charset charset
+    , strf::width_t limit
+    , const typename Charset::code_unit* str
+    , std::size_t str_len )
+{
+    strf::detail::std_width_decrementer_with_pos decr{limit};
+    charset.to_u32().transcode
+        (decr, str, str_len, strf::invalid_seq_notifier{}, strf::surrogate_policy::strict);
+    auto res = decr.get_remaining_width_and_codepoints_count();
+    const strf::width_t width = limit - res.remaining_width;
+    if (res.whole_string_covered) {
+        return {width, str_len};
+    }
+    auto res2 = charset.codepoints_robust_count
+        (str, str_len, res.codepoints_count, strf::surrogate_policy::strict);
+    return {width, res2.pos};
+}
+
+template <typename Charset>
+STRF_HD void test_against_decrementer
+    ( Charset charset
+    , const typename Charset::code_unit* str
+    , std::size_t str_len )
+{
+    const strf::width_t limits[] =
+        { 0, 1, 2, 3, 15, 16, 17, 31, 32, 33, 39, 40, 41, 42, 63, 64, 65, 80, 130
+        , strf::width_max
+        , strf::width_t::from_underlying(0x8000)      // 0.5
+        , strf::width_t::from_underlying(0x18000)     // 1.5
+        , strf::width_t::from_underlying(0x288000) }; // 40.5
+
+    for (auto limit : limits) {
+        TEST_SCOPE_DESCRIPTION("limit = ", limit.floor(), ", str_len = ", str_len);
+
+        const auto expected = width_and_pos_by_decrementer(charset, limit, str, str_len);
+        const auto obtained = strf::std_width_calc_t::str_width_and_pos
+            (charset, limit, str, str_len, strf::surrogate_policy::strict);
+        TEST_TRUE(obtained.width == expected.width);
+        TEST_EQ(obtained.pos, expected.pos);
+
+        const auto obtained_width = strf::std_width_calc_t::str_width
+            (charset, limit, str, str_len, strf::surrogate_policy::strict);
+        TEST_TRUE(obtained_width == expected.width);
+    }
+}
+
+template <typename CharT>
+STRF_HD void test_against_decrementer(const CharT* str)
+{
+    const auto len = strf::detail::str_length(str);
+    test_against_decrementer(strf::utf_t<CharT>{}, str, len);
+    for (std::size_t i = 1; i < len; i += 7) {
+        test_against_decrementer(strf::utf_t<CharT>{}, str, len - i);
+        test_against_decrementer(strf::utf_t<CharT>{}, str + i, len - i);
+    }
+}
+
+#define ASCII_x40 "abcdefghijklmnopqrstuvwxyz0123456789 !@#"
+
+STRF_HD void test_ascii_fast_path()
+{
+    test_against_decrementer("");
+    test_against_decrementer(ASCII_x40);
+    test_against_decrementer(ASCII_x40 "\xCC\x81" ASCII_x40);          // combining acute accent
+    test_against_decrementer(ASCII_x40 "\xE1\x84\x80" ASCII_x40);      // wide
+    test_against_decrementer(ASCII_x40 "\r\n\t" ASCII_x40);
+    test_against_decrementer(ASCII_x40 "\xE2\x80\x8D\xC2\xA9");       // ZWJ and XPIC
+    test_against_decrementer(ASCII_x40 "\xF0" ASCII_x40);                 // invalid UTF-8
+    test_against_decrementer(u"" ASCII_x40 u"\u0301\u0301" ASCII_x40);
+    test_against_decrementer(u"" ASCII_x40 u"\u1100\u036F" ASCII_x40);
+    test_against_decrementer(u"" ASCII_x40 u"\U0001F600");
+    test_against_decrementer(U"" ASCII_x40 U"\u0301" ASCII_x40);
+    test_against_decrementer(U"" ASCII_x40 U"\u00A9\u200D\u00A9" ASCII_x40);
+
+    const char* win1252_str = ASCII_x40 "\xE9\x7F" ASCII_x40;
+    const auto win1252_str_len = strf::detail::str_length(win1252_str);
+    test_against_decrementer(strf::windows_1252_t<char>{}, win1252_str, win1252_str_len);
+
+    const strf::dynamic_charset<char> dyn_cs = strf::windows_1252_t<char>{}.to_dynamic();
+    test_against_decrementer(dyn_cs, win1252_str, win1252_str_len);
+}
+
+// More than STRF_WIDTH_CALC_BUFFER_SIZE code points, so that std_width_calc_t
+// needs to decode the static UTF charsets in more than one chunk
+#define NON_ASCII_x12 \
+    "\u00E1\u0301\u1100\u1161\u11A8\U0001F1E6\U0001F1E7\U0001F600\u200D\U0001F600\r\n"
+#define NON_ASCII_x72 NON_ASCII_x12 NON_ASCII_x12 NON_ASCII_x12 \
+    NON_ASCII_x12 NON_ASCII_x12 NON_ASCII_x12
+
+STRF_HD void test_decoding_in_chunks()
+{
+    const char16_t* u16str = u"" NON_ASCII_x72 u"\xD800" NON_ASCII_x72;
+    const char32_t* u32str = U"" NON_ASCII_x72 U"\xD800" NON_ASCII_x72 U"\x110000";
+    test_against_decrementer(u16str);
+    test_against_decrementer(u32str);
+
+    char u8str[1000];
+    strf::to(u8str) (strf::conv(u16str), "\xF0\x90", strf::conv(u16str), "\xED\xA0\x80");
+    test_against_decrementer(static_cast<const char*>(u8str));
+
+    const strf::dynamic_charset<char16_t> dyn_cs = strf::utf16_t<char16_t>{}.to_dynamic();
+    test_against_decrementer(dyn_cs, u16str, strf::detail::str_length(u16str));
+}
+
 } // unnamed namespace
 
 STRF_TEST_FUNC void test_std_width_calculator()
@@ -1609,6 +1717,8 @@ STRF_TEST_FUNC void test_std_width_calculator()
     test_std_width_decrementer_with_pos();
     other_tests();
     test_many_sequences();
+    test_ascii_fast_path();
+    test_decoding_in_chunks();
 }
 
 REGISTER_STRF_TEST(test_std_width_calculator);
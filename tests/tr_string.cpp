@@ -178,6 +178,95 @@ STRF_TEST_FUNC void test_tr_string()
         log.finish();
         TEST_CSTR_EQ(buff, "\n[22] { }__{2}--{}=={}..{}::{");
     }
+
+    // pre-parsed tr-strings
+    {
+        using tmpl = strf::tr_template<char>;
+        using u16tmpl = strf::tr_template<char16_t>;
+
+        TEST("aaa__..bbb__ 0xa")
+            .tr(tmpl("{}__{}__{}"), "aaa", strf::right("bbb", 5, '.'), *strf::hex(10)>4);
+
+        TEST("_0__1__2")    .tr(tmpl("_{}__{}__{}"),         0, 1, 2);
+        TEST("{0_{_{1_{2")  .tr(tmpl("{{{}_{{_{{{}_{{{}"),   0, 1, 2);
+        TEST("0__1__2")     .tr(tmpl("{}__{}__{"),           0, 1, 2);
+        TEST("0__1__2")     .tr(tmpl("{}__{}__{aaa}"),       0, 1, 2);
+        TEST("0__1__2_")    .tr(tmpl("{}__{}__{aaa}_"),      0, 1, 2);
+        TEST("0__3__1")     .tr(tmpl("{}__{3aa}__{aaa}"),    0, 1, 2, 3);
+        TEST("0__1__3_")    .tr(tmpl("{}__{1}__{3aaa}_"),    0, 1, 2, 3);
+        TEST("_0__10")      .tr(tmpl("_{}__{10"), 0, 1, 2, 3, 4, 5, 6, 7 ,8 ,9, 10);
+        TEST("0__~1")       .tr(tmpl("{}__{-aaa}~{}"),       0, 1);
+        TEST("{__0")        .tr(tmpl("{{{-}__{}"),           0);
+        TEST("{}_{0}__{")   .tr(tmpl("{{}_{{{}}__{{"),       0);
+        TEST(u"{}_{0}__{")  .tr(u16tmpl(u"{{}_{{{}}__{{"),   0);
+        TEST("")            .tr(tmpl(""));
+        TEST("ab")          .tr(tmpl("abc", 2));
+
+        TEST("0 3 \xEF\xBF\xBD \xEF\xBF\xBD 1") .tr(tmpl("{} {3} {4} {5} {1}"), 0, 1, 2, 3);
+        TEST("0 1 2 \xEF\xBF\xBD_")       .tr(tmpl("{} {} {} {aa}_"), 0, 1, 2);
+        TEST("_0__\xEF\xBF\xBD")          .tr(tmpl("_{}__{100"), 0, 1, 2, 3, 4, 5, 6, 7 ,8 ,9, 10);
+        TEST(u"0 3 \uFFFD \uFFFD")          .tr(u16tmpl(u"{} {3} {111} {5 "), 0, 1, 2, 3);
+        TEST(u"\uFFFD")                     .tr(u16tmpl(u"{"));
+
+        // the same template printed more than once
+        const tmpl t("{1} and {0}");
+        TEST_EQ(t.num_args(), 2);
+        TEST_TRUE(t.fully_parsed());
+        TEST("b and a") .tr(t, "a", "b");
+        TEST("1 and 0") .tr(t, 0, 1);
+
+        // more segments than the capacity
+        const strf::tr_template<char, 4> small("{}_{}_{}_{}_{}_{}");
+        TEST_TRUE(! small.fully_parsed());
+        TEST("0_1_2_3_4_5") .tr(small, 0, 1, 2, 3, 4, 5);
+        TEST("0_1_2_3_4_\xEF\xBF\xBD") .tr(small, 0, 1, 2, 3, 4);
+
+        char buff[200];
+        strf::cstr_writer log(buff);
+        TEST("0__\xEF\xBF\xBD--1==2..3::\xEF\xBF\xBD~~")
+            .with(err_handler{log})
+            .tr(tmpl("{ }__{10}--{}=={}..{}::{blah}~~"), 0, 1, 2, 3);
+
+        log.finish();
+        TEST_CSTR_EQ(buff, "\n[ 5] { }__{10}--{}=={}..{}::{blah}~~"
+                           "\n[23] { }__{10}--{}=={}..{}::{blah}~~" );
+    }
+
+#if defined(STRF_TR)
+
+    // tr-strings parsed at compile time
+    TEST("aaa__..bbb__ 0xa")
+        .tr(STRF_TR("{}__{}__{}"), "aaa", strf::right("bbb", 5, '.'), *strf::hex(10)>4);
+
+    TEST(u8"_0__1__2")   .tr(STRF_TR(u8"_{}__{}__{}"),         0, 1, 2);
+    TEST(u8"{0_{_{1_{2") .tr(STRF_TR(u8"{{{}_{{_{{{}_{{{}"),   0, 1, 2);
+    TEST(u8"0__1__2")    .tr(STRF_TR(u8"{}__{}__{"),           0, 1, 2);
+    TEST(u8"0__1__2")    .tr(STRF_TR(u8"{}__{}__{aaa}"),       0, 1, 2);
+    TEST(u8"0__1__2")    .tr(STRF_TR(u8"{}__{}__{aaa"),        0, 1, 2);
+    TEST(u8"0__1__2_")   .tr(STRF_TR(u8"{}__{}__{aaa}_"),      0, 1, 2);
+    TEST(u8"0__3__1")    .tr(STRF_TR(u8"{}__{3aa}__{aaa}"),    0, 1, 2, 3);
+    TEST(u8"0__1__3_")   .tr(STRF_TR(u8"{}__{1}__{3aaa}_"),    0, 1, 2, 3);
+    TEST(u8"_0__10")     .tr(STRF_TR(u8"_{}__{10"), 0, 1, 2, 3, 4, 5, 6, 7 ,8 ,9, 10);
+    TEST(u8"0__~1")      .tr(STRF_TR(u8"{}__{-aaa}~{}"),       0, 1);
+    TEST(u8"{__0")       .tr(STRF_TR(u8"{{{-}__{}"),           0);
+    TEST(u8"0__")        .tr(STRF_TR(u8"{}__{-aaa"),           0);
+    TEST(u8"{}_{0}__{")  .tr(STRF_TR(u8"{{}_{{{}}__{{"),       0);
+    TEST( u"{}_{0}__{")  .tr(STRF_TR( u"{{}_{{{}}__{{"),       0);
+    TEST(U"1 and 0")     .tr(STRF_TR(U"{1} and {0}"),          0, 1);
+    TEST("")             .tr(STRF_TR(""));
+    TEST("abc")          .tr(STRF_TR("abc"));
+    TEST("abc")          .tr(STRF_TR("abc"), 0, 1);
+
+#endif // defined(STRF_TR)
+
+#if defined(STRF_HAS_CLASS_TYPE_TEMPLATE_ARGS)
+
+    TEST("aaa__..bbb__ 0xa")
+        .tr(strf::tr<"{}__{}__{}">, "aaa", strf::right("bbb", 5, '.'), *strf::hex(10)>4);
+    TEST(u"{}_{0}__{") .tr(strf::tr<u"{{}_{{{}}__{{">, 0);
+    TEST(U"1 and 0")   .tr(strf::tr<U"{1} and {0}">, 0, 1);
+
+#endif // defined(STRF_HAS_CLASS_TYPE_TEMPLATE_ARGS)
 }
 
 REGISTER_STRF_TEST(test_tr_string);
@@ -0,0 +1,337 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_utils.hpp"
+
+#if ! defined(_WIN32)
+
+#include <strf/to_uring_fd.hpp>
+#include <strf/to_string.hpp>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+template <typename CharT>
+void test_successfull_writing()
+{
+    auto half_str = test_utils::make_half_string<CharT>();
+    auto long_str = test_utils::make_random_std_string<CharT>(10000);
+
+    auto path = test_utils::unique_tmp_file_name();
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+
+    std::basic_string<CharT> expected;
+    strf::detail::fd_writer_result status;
+    {
+        // small buffers, so that they are recycled many times
+        strf::uring_fd_writer<CharT> writer(fd, strf::min_space_after_recycle<CharT>(), 3);
+        for (int i = 0; i < 20; ++i) {
+            writer.write(half_str.begin(), half_str.size());
+            writer.write(long_str.data(), long_str.size());
+            expected.append(half_str.begin(), half_str.end());
+            expected.append(long_str);
+        }
+        status = writer.finish();
+    }
+    // the file position is at the end of the written content
+    const CharT tail[] = {'x', 'y', 'z'};
+    TEST_EQ(::write(fd, tail, sizeof(tail)), (ssize_t)sizeof(tail));
+    expected.append(tail, 3);
+
+    ::close(fd);
+    auto obtained = test_utils::read_file<CharT>(path.c_str());
+    std::remove(path.c_str());
+
+    TEST_TRUE(status.success);
+    TEST_EQ(status.error, 0);
+    TEST_EQ(status.count, expected.size() - 3);
+    TEST_TRUE(obtained == expected);
+}
+
+template <typename CharT>
+void test_to_uring_fd()
+{
+    auto half_str = test_utils::make_half_string<CharT>();
+    auto long_str = test_utils::make_random_std_string<CharT>(200000);
+
+    auto path = test_utils::unique_tmp_file_name();
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    auto status = strf::to_uring_fd<CharT>(fd) (half_str, long_str, half_str);
+    ::close(fd);
+    auto obtained = test_utils::read_file<CharT>(path.c_str());
+    std::remove(path.c_str());
+
+    std::basic_string<CharT> expected{half_str.begin(), half_str.end()};
+    expected.append(long_str);
+    expected.append(half_str.begin(), half_str.end());
+
+    TEST_TRUE(status.success);
+    TEST_EQ(status.count, expected.size());
+    TEST_TRUE(obtained == expected);
+}
+
+void test_writing_to_pipe()
+{
+    // A pipe is not seekable, so the requests are done one at a time
+    int fds[2];
+    TEST_EQ(::pipe(fds), 0);
+    std::string expected;
+    strf::detail::fd_writer_result status;
+    {
+        strf::uring_fd_writer<char> writer(fds[1], strf::min_space_after_recycle<char>(), 4);
+        for (int i = 0; i < 500; ++i) {
+            strf::to(writer) ("line ", i, '\n');
+            strf::append(expected) ("line ", i, '\n');
+        }
+        status = writer.finish();
+    }
+    ::close(fds[1]);
+    std::string obtained;
+    char buff[1024];
+    ssize_t n;
+    while ((n = ::read(fds[0], buff, sizeof(buff))) > 0) {
+        obtained.append(buff, static_cast<std::size_t>(n));
+    }
+    ::close(fds[0]);
+
+    TEST_TRUE(status.success);
+    TEST_EQ(status.count, expected.size());
+    TEST_TRUE(obtained == expected);
+}
+
+void test_writing_to_read_only_fd()
+{
+    int fd = ::open("/dev/null", O_RDONLY);
+    auto status = strf::to_uring_fd(fd) ("abc");
+    ::close(fd);
+    TEST_FALSE(status.success);
+    TEST_EQ(status.count, 0);
+    TEST_EQ(status.error, EBADF);
+}
+
+// Simulates io_uring: the requests are kept until wait_completion
+// is called, which completes the most recent one ( so that they
+// complete out of order ), writing at most max_bytes_per_call bytes.
+// Fails with ENOSPC beyond limit bytes.
+struct simulated_uring_traits {
+    simulated_uring_traits
+        ( char* dest
+        , std::size_t limit
+        , std::size_t max_bytes_per_call
+        , bool available = true
+        , bool seekable = true )
+        : dest_(dest)
+        , limit_(limit)
+        , max_bytes_per_call_(max_bytes_per_call)
+        , available_(available)
+        , seekable_(seekable)
+    {
+        max_in_flight = 0;
+        final_offset = -1;
+    }
+
+    bool setup(unsigned) noexcept
+    {
+        return available_;
+    }
+
+    std::int64_t start_offset() noexcept
+    {
+        return seekable_ ? 0 : -1;
+    }
+
+    bool set_offset(std::int64_t offset) noexcept
+    {
+        final_offset = offset;
+        return true;
+    }
+
+    bool submit_write
+        ( const void* ptr, std::size_t len
+        , std::int64_t offset, std::uint64_t user_data ) noexcept
+    {
+        requests_.push_back({static_cast<const char*>(ptr), len, offset, user_data});
+        max_in_flight = strf::detail::max(max_in_flight, requests_.size());
+        return true;
+    }
+
+    bool wait_completion(std::uint64_t& user_data, int& res) noexcept
+    {
+        if (requests_.empty()) {
+            errno = EINVAL;
+            return false;
+        }
+        const request_ req = requests_.back();
+        requests_.pop_back();
+        user_data = req.user_data;
+        const std::size_t pos = req.offset < 0 ? append_pos_ : static_cast<std::size_t>(req.offset);
+        if (pos >= limit_) {
+            res = -ENOSPC;
+            return true;
+        }
+        std::size_t n = strf::detail::min(req.len, max_bytes_per_call_);
+        n = strf::detail::min(n, limit_ - pos);
+        std::memcpy(dest_ + pos, req.ptr, n);
+        if (req.offset < 0) {
+            append_pos_ += n;
+        }
+        res = static_cast<int>(n);
+        return true;
+    }
+
+    ssize_t writev(const struct iovec* iov, int iovcnt) noexcept
+    {
+        ++ writev_calls_count;
+        std::size_t count = 0;
+        for (int i = 0; i < iovcnt; ++i) {
+            const std::size_t n = strf::detail::min(iov[i].iov_len, limit_ - append_pos_);
+            std::memcpy(dest_ + append_pos_, iov[i].iov_base, n);
+            append_pos_ += n;
+            count += n;
+        }
+        if (count == 0) {
+            errno = ENOSPC;
+            return -1;
+        }
+        return static_cast<ssize_t>(count);
+    }
+
+    struct request_ {
+        const char* ptr;
+        std::size_t len;
+        std::int64_t offset;
+        std::uint64_t user_data;
+    };
+
+    char* dest_;
+    std::size_t limit_;
+    std::size_t max_bytes_per_call_;
+    bool available_;
+    bool seekable_;
+    std::size_t append_pos_ = 0;
+    std::vector<request_> requests_;
+
+    static std::size_t max_in_flight;
+    static std::int64_t final_offset;
+    static int writev_calls_count;
+};
+
+std::size_t simulated_uring_traits::max_in_flight = 0;
+std::int64_t simulated_uring_traits::final_offset = -1;
+int simulated_uring_traits::writev_calls_count = 0;
+
+using tester_t = strf::detail::uring_fd_writer_base<char, simulated_uring_traits>;
+constexpr std::size_t buff_size = strf::min_space_after_recycle<char>();
+
+void test_out_of_order_and_partial_completions()
+{
+    const auto str = test_utils::make_random_std_string<char>(buff_size * 10);
+    std::vector<char> dest(str.size());
+    {
+        tester_t tester{buff_size, 4, dest.data(), dest.size(), 50};
+        TEST_TRUE(tester.uses_io_uring());
+        strf::to(tester) (str);
+        auto r = tester.finish();
+        TEST_TRUE(r.success);
+        TEST_EQ(r.count, str.size());
+    }
+    TEST_TRUE(std::string(dest.data(), dest.size()) == str);
+    TEST_EQ(simulated_uring_traits::max_in_flight, 4);
+    TEST_EQ(simulated_uring_traits::final_offset, (std::int64_t)str.size());
+}
+
+void test_non_seekable_fd()
+{
+    const auto str = test_utils::make_random_std_string<char>(buff_size * 10);
+    std::vector<char> dest(str.size());
+    {
+        tester_t tester{buff_size, 4, dest.data(), dest.size(), 50, true, false};
+        TEST_TRUE(tester.uses_io_uring());
+        strf::to(tester) (str);
+        auto r = tester.finish();
+        TEST_TRUE(r.success);
+        TEST_EQ(r.count, str.size());
+    }
+    TEST_TRUE(std::string(dest.data(), dest.size()) == str);
+    TEST_EQ(simulated_uring_traits::max_in_flight, 1);
+    TEST_EQ(simulated_uring_traits::final_offset, -1);
+}
+
+void test_failing_to_write()
+{
+    std::vector<char> dest(buff_size * 3);
+    tester_t tester{buff_size, 4, dest.data(), dest.size(), buff_size};
+    strf::to(tester) (strf::multi('x', buff_size * 10));
+    auto r = tester.finish();
+
+    TEST_FALSE(r.success);
+    TEST_EQ(r.error, ENOSPC);
+    TEST_EQ(r.count, buff_size * 3);
+    TEST_EQ(simulated_uring_traits::final_offset, -1);
+}
+
+void test_when_io_uring_is_not_available()
+{
+    const auto str = test_utils::make_random_std_string<char>(buff_size * 10);
+    std::vector<char> dest(str.size());
+    simulated_uring_traits::writev_calls_count = 0;
+    {
+        tester_t tester{buff_size, 4, dest.data(), dest.size(), 50, false};
+        TEST_FALSE(tester.uses_io_uring());
+        strf::to(tester) (str);
+        auto r = tester.finish();
+        TEST_TRUE(r.success);
+        TEST_EQ(r.count, str.size());
+    }
+    TEST_TRUE(std::string(dest.data(), dest.size()) == str);
+    TEST_EQ(simulated_uring_traits::max_in_flight, 0);
+    TEST_TRUE(simulated_uring_traits::writev_calls_count >= 10);
+}
+
+void test_when_finish_is_not_called()
+{
+    std::vector<char> dest(buff_size * 4);
+    {
+        tester_t tester{buff_size, 2, dest.data(), dest.size(), 50};
+        strf::to(tester) ("abc", strf::multi('x', buff_size * 3), "def");
+    }
+    const std::string obtained(dest.data(), buff_size * 3 + 6);
+    TEST_TRUE(obtained.substr(0, 3) == "abc");
+    TEST_TRUE(obtained.substr(buff_size * 3 + 3) == "def");
+    TEST_EQ(simulated_uring_traits::final_offset, (std::int64_t)obtained.size());
+}
+
+} // unnamed namespace
+
+void test_uring_fd_writer()
+{
+    test_successfull_writing<char>();
+    test_successfull_writing<char16_t>();
+    test_successfull_writing<char32_t>();
+
+    test_to_uring_fd<char>();
+    test_to_uring_fd<wchar_t>();
+
+    test_writing_to_pipe();
+    test_writing_to_read_only_fd();
+
+    test_out_of_order_and_partial_completions();
+    test_non_seekable_fd();
+    test_failing_to_write();
+    test_when_io_uring_is_not_available();
+    test_when_finish_is_not_called();
+}
+
+#else
+
+void test_uring_fd_writer()
+{
+}
+
+#endif // ! defined(_WIN32)
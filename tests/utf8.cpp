@@ -178,6 +178,45 @@ STRF_TEST_FUNC void utf8_sani_invalid_sequences()
     TEST_CALLING_RECYCLE_AT<4>  (u8" \uFFFD")              (strf::sani("\xED\xA0\x80") > 4);
 }
 
+STRF_TEST_FUNC void utf8_sani_long_sequences()
+{
+    // cover code paths that may validate and copy many bytes at once
+    TEST(u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\u00E9\u0800\U00010000abcdefghijklmnopqrstuvwxyz"
+         u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\U0010FFFF\uD7FFabcdefghijklmnopqrstuvwxyz")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3\xA9\xE0\xA0\x80\xF0\x90\x80\x80"
+                    "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                    "\xF4\x8F\xBF\xBF\xED\x9F\xBF" "abcdefghijklmnopqrstuvwxyz"));
+    TEST(u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\u00E9abcdefghijklmnopqrstuvwxyz"
+         u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\uFFFDabcdefghijklmnopqrstuvwxyz"
+         u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\uFFFDabcdefghijklmnopqrstuvwxyz")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3\xA9" "abcdefghijklmnopqrstuvwxyz"
+                    "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xFF" "abcdefghijklmnopqrstuvwxyz"
+                    "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3" "abcdefghijklmnopqrstuvwxyz"));
+    TEST(u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz\uFFFD\uFFFD\uFFFD"
+         u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz\xED\xA0\x80"
+                    "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"));
+    TEST("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz\xED\xA0\x80"
+         "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz")
+        .with(strf::surrogate_policy::lax)
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz\xED\xA0\x80"
+                    "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"));
+    TEST(u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz\uFFFD")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz\xF0\x90\x80"));
+
+    TEST_CALLING_RECYCLE_AT<20> (u8"0123456789ABCDEFGHIJ")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"));
+    TEST_CALLING_RECYCLE_AT<20, 30>
+        (u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\u00E9abcdefghijkl")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3\xA9" "abcdefghijklmnopqrstuvwxyz"
+                    "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+    TEST_CALLING_RECYCLE_AT<40, 60>
+        (u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\u00E9abcdefghijklmnopqrstuvwxyz"
+         u8"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3\xA9" "abcdefghijklmnopqrstuvwxyz"
+                    "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+}
+
 STRF_TEST_FUNC int error_handler_calls_count = 0 ;
 struct dummy_exception {};
 
@@ -398,6 +437,7 @@ STRF_TEST_FUNC void test_utf8()
 {
     utf8_sani_valid_sequences();
     utf8_sani_invalid_sequences();
+    utf8_sani_long_sequences();
     utf8_sani_error_notifier();
     utf8_sani_find_transcoder();
     utf8_codepoints_count();
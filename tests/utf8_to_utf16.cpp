@@ -166,6 +166,75 @@ STRF_TEST_FUNC void utf8_to_utf16_invalid_sequences()
     TEST_CALLING_RECYCLE_AT<2>  (u" \uFFFD")              (strf::sani("\xED\xA0\x80") > 4);
 }
 
+STRF_TEST_FUNC void utf8_to_utf16_long_sequences()
+{
+    // cover code paths that may process many ASCII characters at once
+    TEST(u"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"));
+    TEST(u"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\u00E9abcdefghijklmnopqrstuvwxyz")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3\xA9" "abcdefghijklmnopqrstuvwxyz"));
+    TEST(u"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\U00010000abcdefghijklmnopqrstuvwxyz")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xF0\x90\x80\x80" "abcdefghijklmnopqrstuvwxyz"));
+    TEST(u"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\uFFFDabcdefghijklmnopqrstuvwxyz")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xFF" "abcdefghijklmnopqrstuvwxyz"));
+    TEST(u"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\uFFFD")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3"));
+
+    TEST_CALLING_RECYCLE_AT<20> (u"0123456789ABCDEFGHIJ")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"));
+    TEST_CALLING_RECYCLE_AT<20, 30> (u"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\u00E9abcdefghijklm")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3\xA9" "abcdefghijklmnopqrstuvwxyz"));
+    TEST_CALLING_RECYCLE_AT<36, 40> (u"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\u00E9abcdefghijklmnopqrstuvwxyz")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ\xC3\xA9" "abcdefghijklmnopqrstuvwxyz"));
+}
+
+// Inserts the UTF-8 sequence `seq` at position `pos` of a string
+// of ASCII characters
+STRF_TEST_FUNC void check_sequence_at
+    ( std::size_t pos
+    , const char* seq
+    , const char16_t* expected_seq )
+{
+    constexpr std::size_t ascii_count = 48;
+    char input[ascii_count + 5];
+    char16_t expected[ascii_count + 3];
+    const auto seq_len = strf::detail::str_length(seq);
+    const auto expected_seq_len = strf::detail::str_length(expected_seq);
+    std::size_t i = 0;
+    for (; i < pos; ++i) {
+        input[i] = static_cast<char>('a' + i % 26);
+        expected[i] = static_cast<char16_t>('a' + i % 26);
+    }
+    strf::detail::copy_n(seq, seq_len, input + pos);
+    strf::detail::copy_n(expected_seq, expected_seq_len, expected + pos);
+    for (; i < ascii_count; ++i) {
+        input[i + seq_len] = static_cast<char>('A' + i % 26);
+        expected[i + expected_seq_len] = static_cast<char16_t>('A' + i % 26);
+    }
+    input[ascii_count + seq_len] = '\0';
+    expected[ascii_count + expected_seq_len] = 0;
+
+    TEST(expected) (strf::sani(input));
+}
+
+STRF_TEST_FUNC void utf8_to_utf16_sequences_at_block_boundaries()
+{
+    // multi-byte and invalid sequences starting, ending or crossing
+    // at the boundaries of the blocks processed by the SIMD fast path
+    // ( 16 or 32 bytes )
+    for (std::size_t pos = 12; pos <= 34; ++pos) {
+        check_sequence_at(pos, "\xC3\xA9", u"\u00E9");
+        check_sequence_at(pos, "\xE2\x82\xAC", u"\u20AC");
+        check_sequence_at(pos, "\xF0\x90\x80\x80", u"\U00010000");
+        check_sequence_at(pos, "\xFF", u"\uFFFD");
+    }
+    // a destination recycle in the middle of the SIMD block
+    TEST_CALLING_RECYCLE_AT<15, 50> (u"0123456789ABCDE\u00E9FGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz")
+        (strf::sani("0123456789ABCDE\xC3\xA9" "FGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"));
+    TEST_CALLING_RECYCLE_AT<16, 50> (u"0123456789ABCDEFGHIJKLMNOPQRSTU\u00E9VWXYZabcdefghijklmnopqrstuvwxyz")
+        (strf::sani("0123456789ABCDEFGHIJKLMNOPQRSTU\xC3\xA9" "VWXYZabcdefghijklmnopqrstuvwxyz"));
+}
+
 STRF_TEST_FUNC int error_handler_calls_count = 0 ;
 struct dummy_exception {};
 
@@ -231,6 +300,8 @@ STRF_TEST_FUNC void test_utf8_to_utf16()
 {
     utf8_to_utf16_valid_sequences();
     utf8_to_utf16_invalid_sequences();
+    utf8_to_utf16_long_sequences();
+    utf8_to_utf16_sequences_at_block_boundaries();
     utf8_to_utf16_error_notifier();
     utf8_to_utf16_find_transcoder();
 }
@@ -48,6 +48,45 @@ STRF_TEST_FUNC void test_width_calculator()
         TEST( u"  \u2E3A\u2E3A\u2014") .with(wcalc)
             (strf::right( u"\u2E3A\u2E3A\u2014", 12));
 
+        {
+            // More than STRF_WIDTH_CALC_BUFFER_SIZE code points
+            char16_t u16str[200];
+            for (std::size_t i = 0; i < 200; ++i) {
+                u16str[i] = (i % 3 == 0 ? u'\u2014' : u'a');
+            }
+            u16str[100] = 0xD800;
+            using u16view = strf::detail::simple_string_view<char16_t>;
+            char u8str[600];
+            const auto u8str_len = static_cast<std::size_t>
+                ( strf::to(u8str) (strf::conv(u16view(u16str, 200))).ptr - u8str );
+
+            const strf::dynamic_charset<char16_t> dyn_cs = strf::utf16_t<char16_t>{}.to_dynamic();
+            const auto strict = strf::surrogate_policy::strict;
+
+            auto res = wcalc.str_width_and_pos(strf::utf16_t<char16_t>{}, 300, u16str, 200, strict);
+            TEST_TRUE(res.width == 267);
+            TEST_EQ(res.pos, 200);
+
+            const strf::width_t limits[] = {0, 1, 60, 63, 64, 100, 150, 266, 267};
+            for (auto limit : limits) {
+                TEST_SCOPE_DESCRIPTION("limit = ", limit.floor());
+                auto expected = wcalc.str_width_and_pos(dyn_cs, limit, u16str, 200, strict);
+                auto res16 = wcalc.str_width_and_pos
+                    (strf::utf16_t<char16_t>{}, limit, u16str, 200, strict);
+                auto res8 = wcalc.str_width_and_pos
+                    (strf::utf8_t<char>{}, limit, u8str, u8str_len, strict);
+                TEST_TRUE(res16.width == expected.width);
+                TEST_TRUE(res8.width == expected.width);
+                TEST_EQ(res16.pos, expected.pos);
+                char u8prefix[600];
+                const auto u8prefix_len = static_cast<std::size_t>
+                    ( strf::to(u8prefix) (strf::conv(u16view(u16str, expected.pos))).ptr - u8prefix );
+                TEST_EQ(res8.pos, u8prefix_len);
+                TEST_TRUE(expected.width == wcalc.str_width
+                          (strf::utf16_t<char16_t>{}, limit, u16str, 200, strict));
+            }
+        }
+
         // TEST( U"  \u2E3A\u2E3A\u2014") .with(wcalc)
         //     (strf::right( U"\u2E3A\u2E3A\u2014", 12));
 
@@ -258,6 +297,15 @@ STRF_TEST_FUNC void test_width_calculator()
         TEST_W_AS_U32LEN(str_0xDFFF_0xD800) (strf::right(str_0xDFFF_0xD800 + 1, 6));
 
     }
+    {   // charset ids are not ordered, so each one is listed explicitly
+        TEST_TRUE(strf::detail::is_ascii_compatible(strf::csid_utf8));
+        TEST_TRUE(strf::detail::is_ascii_compatible(strf::csid_iso_8859_11));
+        TEST_TRUE(strf::detail::is_ascii_compatible(strf::csid_windows_1258));
+        // ids between the ones of known charsets
+        TEST_FALSE(strf::detail::is_ascii_compatible((strf::charset_id)0xcf00a412));
+        TEST_FALSE(strf::detail::is_ascii_compatible((strf::charset_id)0xcf00a40f));
+        TEST_FALSE(strf::detail::is_ascii_compatible((strf::charset_id)0x5cff7300));
+    }
 }
 
 REGISTER_STRF_TEST(test_width_calculator);
@@ -0,0 +1,315 @@
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// Generates include/strf/detail/ch32_width_and_gcb_prop.hpp
+//
+// The Grapheme_Cluster_Break and Extended_Pictographic properties are
+// obtained from ICU, so to update the table to a newer version of Unicode,
+// just build this program against a newer ICU:
+//
+//     c++ -std=c++11 -o generate_ch32_width_and_gcb_prop
+//         tools/generate_ch32_width_and_gcb_prop.cpp -licuuc -licudata
+//     ./generate_ch32_width_and_gcb_prop > include/strf/detail/ch32_width_and_gcb_prop.hpp
+//
+// The result can then be checked with tests/ch32_width_and_gcb_prop.cpp
+// ( CMake option STRF_BUILD_TEST_CH32_WIDTH_AND_GCB_PROP ).
+//
+// The table has three stages, whose block sizes are chosen to
+// minimize the total size ( see struct tables below ).
+
+#include <unicode/uchar.h>
+#include <unicode/uversion.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+namespace {
+
+// Must be kept in sync with the constants in the generated file
+enum category : std::uint8_t {
+    other = 0,
+    extend,
+    control,
+    cr,
+    lf,
+    spacing_mark,
+    prepend,
+    hangul_l,
+    hangul_v,
+    hangul_t,
+    hangul_lv,
+    hangul_lvt,
+    regional_indicator,
+    zwj,
+    extended_picto
+};
+
+constexpr std::uint8_t wide_flag = 0x10;
+constexpr std::uint32_t codepoints_count = 0x110000;
+
+bool is_fullwidth(UChar32 ch)
+{
+    // according to http://eel.is/c++draft/format.string.std#11
+    return  (0x1100 <= ch && ch <= 0x115F)
+        ||  (0x2329 <= ch && ch <= 0x232A)
+        ||  (0x2E80 <= ch && ch <= 0x303E)
+        ||  (0x3040 <= ch && ch <= 0xA4CF)
+        ||  (0xAC00 <= ch && ch <= 0xD7A3)
+        ||  (0xF900 <= ch && ch <= 0xFAFF)
+        ||  (0xFE10 <= ch && ch <= 0xFE19)
+        ||  (0xFE30 <= ch && ch <= 0xFE6F)
+        ||  (0xFF00 <= ch && ch <= 0xFF60)
+        ||  (0xFFE0 <= ch && ch <= 0xFFE6)
+        || (0x1F300 <= ch && ch <= 0x1F64F)
+        || (0x1F900 <= ch && ch <= 0x1F9FF)
+        || (0x20000 <= ch && ch <= 0x2FFFD)
+        || (0x30000 <= ch && ch <= 0x3FFFD);
+}
+
+category get_category(UChar32 ch)
+{
+    if (u_getIntPropertyValue(ch, UCHAR_EXTENDED_PICTOGRAPHIC)) {
+        return extended_picto;
+    }
+    if (ch == 0x11720 || ch == 0x11721) {
+        return other;
+    }
+    switch (u_getIntPropertyValue(ch, UCHAR_GRAPHEME_CLUSTER_BREAK)) {
+        case U_GCB_EXTEND:             return extend;
+        case U_GCB_CONTROL:            return control;
+        case U_GCB_CR:                 return cr;
+        case U_GCB_LF:                 return lf;
+        case U_GCB_SPACING_MARK:       return spacing_mark;
+        case U_GCB_PREPEND:            return prepend;
+        case U_GCB_L:                  return hangul_l;
+        case U_GCB_V:                  return hangul_v;
+        case U_GCB_T:                  return hangul_t;
+        case U_GCB_LV:                 return hangul_lv;
+        case U_GCB_LVT:                return hangul_lvt;
+        case U_GCB_REGIONAL_INDICATOR: return regional_indicator;
+        case U_GCB_ZWJ:                return zwj;
+        default:                       return other;
+    }
+}
+
+// Splits `values` into blocks of `block_size` elements, removing the
+// duplicated ones, and stores in `index` the position of each block
+template <typename T>
+std::vector<std::vector<T>> split_in_blocks
+    ( const std::vector<T>& values
+    , std::size_t block_size
+    , std::vector<std::uint32_t>& index )
+{
+    std::vector<std::vector<T>> blocks;
+    std::map<std::vector<T>, std::uint32_t> blocks_map;
+    for (std::size_t i = 0; i < values.size(); i += block_size) {
+        std::vector<T> block(values.begin() + i, values.begin() + i + block_size);
+        auto it = blocks_map.find(block);
+        if (it == blocks_map.end()) {
+            const auto block_index = static_cast<std::uint32_t>(blocks.size());
+            it = blocks_map.emplace(block, block_index).first;
+            blocks.push_back(block);
+        }
+        index.push_back(it->second);
+    }
+    return blocks;
+}
+
+int log2(std::size_t x)
+{
+    int n = 0;
+    while ((std::size_t(1) << n) < x) {
+        ++n;
+    }
+    return n;
+}
+
+const char* index_type(std::size_t max_value)
+{
+    return max_value <= 0x100 ? "std::uint8_t" : "std::uint16_t";
+}
+
+std::size_t index_type_size(std::size_t max_value)
+{
+    return max_value <= 0x100 ? 1 : 2;
+}
+
+// Each code point is mapped to a value in stage3, using its least
+// significant bits. The more significant bits are used to select
+// a block in stage3 from a block in stage2, which is selected by stage1.
+struct tables {
+    std::size_t stage3_block_size = 0;
+    std::size_t stage2_block_size = 0;
+    std::vector<std::uint32_t> stage1;
+    std::vector<std::vector<std::uint32_t>> stage2;
+    std::vector<std::vector<std::uint8_t>> stage3;
+
+    std::size_t total_size() const
+    {
+        return stage1.size() * index_type_size(stage2.size())
+            + stage2.size() * stage2_block_size * index_type_size(stage3.size())
+            + stage3.size() * stage3_block_size;
+    }
+};
+
+tables make_tables
+    ( const std::vector<std::uint8_t>& props
+    , std::size_t stage3_block_size
+    , std::size_t stage2_block_size )
+{
+    tables t;
+    t.stage3_block_size = stage3_block_size;
+    t.stage2_block_size = stage2_block_size;
+    std::vector<std::uint32_t> stage3_index;
+    t.stage3 = split_in_blocks(props, stage3_block_size, stage3_index);
+    t.stage2 = split_in_blocks(stage3_index, stage2_block_size, t.stage1);
+    return t;
+}
+
+template <typename T>
+void print_values(const std::vector<T>& values, std::size_t per_line, int width)
+{
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (i == 0) {
+            std::printf("{ ");
+        } else if (i % per_line == 0) {
+            std::printf("\n          , ");
+        } else {
+            std::printf(", ");
+        }
+        std::printf("%*u", width, (unsigned)values[i]);
+    }
+    std::printf(" }");
+}
+
+template <typename T>
+void print_blocks(const std::vector<std::vector<T>>& blocks, std::size_t per_line, int width)
+{
+    for (std::size_t b = 0; b < blocks.size(); ++b) {
+        std::printf(b == 0 ? "        { /* %u */\n          " : "        , /* %u */\n          ", (unsigned)b);
+        print_values(blocks[b], per_line, width);
+        std::printf("\n");
+    }
+    std::printf("        };\n");
+}
+
+void print_header(const tables& t)
+{
+    std::printf(
+R"(#ifndef STRF_DETAIL_CH32_WIDTH_AND_GCB_PROP_HPP
+#define STRF_DETAIL_CH32_WIDTH_AND_GCB_PROP_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This file was generated by tools/generate_ch32_width_and_gcb_prop.cpp
+// from the data of ICU %s ( Unicode %s ). Do not edit it manually.
+
+#include <strf/detail/strf_def.hpp>
+#include <cstdint>
+
+namespace strf {
+namespace detail {
+
+// Values returned by ch32_width_and_gcb_prop. The four lowest bits
+// contain the Grapheme_Cluster_Break property, except that
+// extended_picto is used for the Extended_Pictographic code points.
+// The bit `wide` is set when the width of the code point is 2.
+namespace gcb_prop {
+
+constexpr unsigned other              = %u;
+constexpr unsigned extend             = %u;
+constexpr unsigned control            = %u;
+constexpr unsigned cr                 = %u;
+constexpr unsigned lf                 = %u;
+constexpr unsigned spacing_mark       = %u;
+constexpr unsigned prepend            = %u;
+constexpr unsigned hangul_l           = %u;
+constexpr unsigned hangul_v           = %u;
+constexpr unsigned hangul_t           = %u;
+constexpr unsigned hangul_lv          = %u;
+constexpr unsigned hangul_lvt         = %u;
+constexpr unsigned regional_indicator = %u;
+constexpr unsigned zwj                = %u;
+constexpr unsigned extended_picto     = %u;
+constexpr unsigned category_mask      = 0x0F;
+constexpr unsigned wide               = 0x%02X;
+
+} // namespace gcb_prop
+
+#if ! defined(STRF_OMIT_IMPL)
+
+STRF_FUNC_IMPL STRF_HD unsigned ch32_width_and_gcb_prop(char32_t ch) noexcept
+{
+)"
+        , U_ICU_VERSION, U_UNICODE_VERSION
+        , other, extend, control, cr, lf, spacing_mark, prepend
+        , hangul_l, hangul_v, hangul_t, hangul_lv, hangul_lvt
+        , regional_indicator, zwj, extended_picto, wide_flag );
+
+    std::printf("    static const %s stage1[] =\n        ", index_type(t.stage2.size()));
+    print_values(t.stage1, 16, 3);
+    std::printf(";\n");
+    std::printf( "    static const %s stage2[][%u] =\n"
+               , index_type(t.stage3.size()), (unsigned)t.stage2_block_size );
+    print_blocks(t.stage2, 16, 3);
+    std::printf("    static const std::uint8_t stage3[][%u] =\n", (unsigned)t.stage3_block_size);
+    print_blocks(t.stage3, 32, 2);
+
+    const int stage3_bits = log2(t.stage3_block_size);
+    const int stage2_bits = log2(t.stage2_block_size);
+    std::printf(
+R"(
+    if (ch >= 0x110000) {
+        return gcb_prop::other;
+    }
+    const auto block2 = stage1[ch >> %d];
+    const auto block3 = stage2[block2][(ch >> %d) & 0x%X];
+    return stage3[block3][ch & 0x%X];
+}
+
+#else
+
+STRF_HD unsigned ch32_width_and_gcb_prop(char32_t ch) noexcept;
+
+#endif // ! defined(STRF_OMIT_IMPL)
+
+} // namespace detail
+} // namespace strf
+
+#endif  // STRF_DETAIL_CH32_WIDTH_AND_GCB_PROP_HPP
+)"
+        , stage3_bits + stage2_bits
+        , stage3_bits, (unsigned)t.stage2_block_size - 1
+        , (unsigned)t.stage3_block_size - 1 );
+}
+
+} // unnamed namespace
+
+int main()
+{
+    std::vector<std::uint8_t> props(codepoints_count);
+    for (UChar32 ch = 0; ch < (UChar32)codepoints_count; ++ch) {
+        props[ch] = get_category(ch) | (is_fullwidth(ch) ? wide_flag : 0);
+    }
+    tables best;
+    for (std::size_t stage3_block_size = 16; stage3_block_size <= 256; stage3_block_size *= 2) {
+        for (std::size_t stage2_block_size = 4; stage2_block_size <= 256; stage2_block_size *= 2) {
+            tables t = make_tables(props, stage3_block_size, stage2_block_size);
+            if (best.stage3_block_size == 0 || t.total_size() < best.total_size()) {
+                best = std::move(t);
+            }
+        }
+    }
+    std::fprintf( stderr, "block sizes = %u and %u, total size = %u bytes\n"
+                , (unsigned)best.stage3_block_size, (unsigned)best.stage2_block_size
+                , (unsigned)best.total_size() );
+    print_header(best);
+    return EXIT_SUCCESS;
+}
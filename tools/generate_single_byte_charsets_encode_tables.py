@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+
+#  Copyright (C) (See commit logs on github.com/robhz786/strf)
+#  Distributed under the Boost Software License, Version 1.0.
+#  (See accompanying file LICENSE_1_0.txt or copy at
+#  http://www.boost.org/LICENSE_1_0.txt)
+
+"""Generates include/strf/detail/single_byte_charsets_encode_tables.hpp
+
+It contains the definitions of the encode_ext functions of the classes
+in include/strf/detail/single_byte_charsets.hpp. Each one maps a code
+point to its single-byte encoding through two tables: the first one is
+indexed by the code point divided by the block size and gives the
+index of a block in the second one, which is indexed by the remainder.
+Zero in the second table means that the code point is not supported.
+
+The mappings are read from the decode functions in the same header,
+so that the encoding can not disagree with the decoding. Each decode
+function is expected to contain a table named "ext", accessed as
+"ext[ch - <first byte>]", and possibly a switch with cases like
+"case 0xD0: return 0x011E;". The remaining bytes decode to the code
+points with the same value. Bytes that decode to U+FFFD ( or "undef" )
+are not valid.
+
+Usage: generate_single_byte_charsets_encode_tables.py [output-file]
+"""
+
+import os
+import re
+import sys
+
+BLOCK_SIZE = 32
+
+CHARSETS = [
+    "iso_8859_2",
+    "iso_8859_3",
+    "iso_8859_4",
+    "iso_8859_5",
+    "iso_8859_6",
+    "iso_8859_7",
+    "iso_8859_8",
+    "iso_8859_10",
+    "iso_8859_11",
+    "iso_8859_13",
+    "iso_8859_14",
+    "iso_8859_15",
+    "iso_8859_16",
+    "windows_1250",
+    "windows_1251",
+    "windows_1252",
+    "windows_1253",
+    "windows_1254",
+    "windows_1255",
+    "windows_1256",
+    "windows_1257",
+    "windows_1258",
+]
+
+INCLUDE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "include")
+
+
+def impl_source(source, name):
+    begin = re.search(r"^(struct|class) impl_%s\b" % name, source, re.M)
+    assert begin, "impl_%s not found" % name
+    end = re.search(r"^};", source[begin.end():], re.M)
+    return source[begin.end():begin.end() + end.start()]
+
+
+def decode_table(source, name):
+    impl = impl_source(source, name)
+    decode = impl[impl.index("char32_t decode(std::uint8_t ch)"):]
+    decode = decode[:decode.find("static STRF_HD", 1)]
+    values = re.search(r"ext\[\]\s*=\s*\{(.*?)\}", decode, re.S).group(1)
+    values = re.sub(r"/\*.*?\*/", "", values)
+    values = [v.strip() for v in values.split(",") if v.strip()]
+    ext = [0xFFFD if v == "undef" else int(v, 16) for v in values]
+    first = int(re.search(r"return ext\[ch - (0x[0-9A-Fa-f]+)\];", decode).group(1), 16)
+    assert first + len(ext) <= 0x100
+    table = {byte: byte for byte in range(0x100)}
+    for i, code_point in enumerate(ext):
+        table[first + i] = code_point
+    for byte, code_point in re.findall(r"case (0x[0-9A-Fa-f]+): return (0x[0-9A-Fa-f]+);", decode):
+        table[int(byte, 16)] = int(code_point, 16)
+    return {byte: cp for byte, cp in table.items() if cp != 0xFFFD}
+
+
+def encode_tables(decoded):
+    encoded = {}
+    for byte, code_point in decoded.items():
+        if code_point >= 0x80:
+            assert byte != 0
+            encoded[code_point] = byte
+    blocks = [[0] * BLOCK_SIZE]
+    blocks_index = [0] * (max(encoded) // BLOCK_SIZE + 1)
+    for code_point in sorted(encoded):
+        i = code_point // BLOCK_SIZE
+        if blocks_index[i] == 0:
+            blocks_index[i] = len(blocks)
+            blocks.append([0] * BLOCK_SIZE)
+        blocks[blocks_index[i]][code_point % BLOCK_SIZE] = encoded[code_point]
+    assert len(blocks) < 0x100
+    return blocks_index, blocks
+
+
+def format_values(values, per_line, separator):
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        lines.append(", ".join("0x%02X" % x for x in chunk))
+    return separator.join(lines)
+
+
+def generate_function(source, name):
+    blocks_index, blocks = encode_tables(decode_table(source, name))
+    out = []
+    out.append("STRF_FUNC_IMPL STRF_HD unsigned impl_%s::encode_ext(char32_t ch)" % name)
+    out.append("{")
+    out.append("    static const std::uint8_t blocks_index[] =")
+    out.append("        { " + format_values(blocks_index, 12, "\n        , ") + " };")
+    out.append("    static const std::uint8_t blocks[][%d] =" % BLOCK_SIZE)
+    for i, block in enumerate(blocks):
+        prefix = "        { {" if i == 0 else "        , {"
+        out.append("%s /*%02X*/ %s" % (prefix, i, format_values(block, 8, ",\n                 ")) + " }")
+    out.append("        };")
+    out.append("    return strf::detail::encode_using_tables(ch, blocks_index, blocks);")
+    out.append("}")
+    return "\n".join(out)
+
+
+HEADER = """\
+#ifndef STRF_DETAIL_SINGLE_BYTE_CHARSETS_ENCODE_TABLES_HPP
+#define STRF_DETAIL_SINGLE_BYTE_CHARSETS_ENCODE_TABLES_HPP
+
+//  Copyright (C) (See commit logs on github.com/robhz786/strf)
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// This file was generated by tools/generate_single_byte_charsets_encode_tables.py
+// Do not edit it manually.
+
+// It is meant to be included only by strf/detail/single_byte_charsets.hpp
+
+namespace strf {
+namespace detail {
+"""
+
+FOOTER = """
+} // namespace detail
+} // namespace strf
+
+#endif  // STRF_DETAIL_SINGLE_BYTE_CHARSETS_ENCODE_TABLES_HPP
+"""
+
+
+def main():
+    if len(sys.argv) > 1:
+        output = sys.argv[1]
+    else:
+        output = os.path.join( INCLUDE_DIR, "strf", "detail"
+                             , "single_byte_charsets_encode_tables.hpp" )
+    with open(os.path.join(INCLUDE_DIR, "strf", "detail", "single_byte_charsets.hpp")) as f:
+        source = f.read()
+    functions = [generate_function(source, name) for name in CHARSETS]
+    with open(output, "w", newline="\n") as f:
+        f.write(HEADER)
+        for func in functions:
+            f.write("\n")
+            f.write(func)
+            f.write("\n")
+        f.write(FOOTER)
+
+
+if __name__ == "__main__":
+    main()